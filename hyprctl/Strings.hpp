@@ -32,6 +32,10 @@ commands:
                           with ESCAPE
     layers              → Lists all the surface layers
     layouts             → Lists all layouts available (including plugin'd ones)
+    metrics [prometheus|reset] → Prints per-monitor render, frame interval,
+                          commit-to-present and input-to-present latency
+                          percentiles, optionally in the Prometheus text
+                          format. 'reset' clears them
     monitors            → Lists active outputs with their properties,
                           'monitors all' lists active and inactive outputs
     notify ...          → Sends a notification using the built-in Hyprland
@@ -50,8 +54,13 @@ commands:
                           when Hyprland's config is reloaded
     setprop ...         → Sets a window property
     splash              → Get the current splash
+    startup             → Prints the startup timeline: stage timestamps and
+                          background init task durations
     switchxkblayout ... → Sets the xkb layout index for a keyboard
     systeminfo          → Get system info
+    trace start|stop [file]|status → Records render loop, input and IPC
+                          timings, and writes them to FILE as a Chrome
+                          trace-event JSON on stop
     version             → Prints the hyprland version, meaning flags, commit
                           and branch of build.
     workspacerules      → Lists all workspace rules
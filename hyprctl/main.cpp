@@ -417,7 +417,11 @@ int main(int argc, char** argv) {
             continue;
         }
 
-        fullRequest += ARGS[i] + " ";
+        // the compositor writes the trace, so resolve relative paths against our cwd
+        if (i >= 2 && ARGS[i - 2] == "trace" && ARGS[i - 1] == "stop" && !ARGS[i].starts_with("/"))
+            fullRequest += std::filesystem::absolute(ARGS[i]).string() + " ";
+        else
+            fullRequest += ARGS[i] + " ";
     }
 
     if (fullRequest.empty()) {
@@ -14,6 +14,7 @@
 #include "managers/VersionKeeperManager.hpp"
 #include "managers/DonationNagManager.hpp"
 #include "managers/ANRManager.hpp"
+#include "managers/SelectionCacheManager.hpp"
 #include "managers/eventLoop/EventLoopManager.hpp"
 #include "managers/permissions/DynamicPermissionManager.hpp"
 #include <algorithm>
@@ -62,6 +63,10 @@
 #include "hyprerror/HyprError.hpp"
 #include "debug/HyprNotificationOverlay.hpp"
 #include "debug/HyprDebugOverlay.hpp"
+#include "debug/FrameTracer.hpp"
+#include "debug/FrameMetrics.hpp"
+#include "helpers/StartupTasks.hpp"
+#include "devices/KeymapCache.hpp"
 
 #include <hyprutils/string/String.hpp>
 #include <aquamarine/input/Input.hpp>
@@ -78,6 +83,9 @@ using namespace Aquamarine;
 using enum NContentType::eContentType;
 using namespace NColorManagement;
 
+// written by the "system info" startup task, read on the main thread once that finished
+static std::string startupSystemInfo;
+
 static int handleCritSignal(int signo, void* data) {
     Debug::log(LOG, "Hyprland received signal {}", signo);
 
@@ -221,17 +229,16 @@ CCompositor::CCompositor(bool onlyConfig) : m_onlyConfigVerification(onlyConfig)
 
     Debug::init(m_instancePath);
 
+    g_pStartupTasks = makeUnique<CStartupTasks>();
+
     Debug::log(LOG, "Instance Signature: {}", m_instanceSignature);
 
     Debug::log(LOG, "Runtime directory: {}", m_instancePath);
 
     Debug::log(LOG, "Hyprland PID: {}", m_iHyprlandPID);
 
-    Debug::log(LOG, "===== SYSTEM INFO: =====");
-
-    logSystemInfo();
-
-    Debug::log(LOG, "========================");
+    // lspci and friends can take a while, no need to hold up startup for them. Logged in one go once init is done, see initServer
+    g_pStartupTasks->spawn("system info", [] { startupSystemInfo = getSystemInfoLog(); });
 
     Debug::log(NONE, "\n\n"); // pad
 
@@ -350,6 +357,8 @@ void CCompositor::initServer(std::string socketName, int socketFd) {
 
     m_initialized = true;
 
+    g_pStartupTasks->mark("backend started");
+
     m_drmFD = m_aqBackend->drmFD();
     Debug::log(LOG, "Running on DRMFD: {}", m_drmFD);
 
@@ -395,8 +404,15 @@ void CCompositor::initServer(std::string socketName, int socketFd) {
 
     initManagers(STAGE_BASICINIT);
 
+    g_pStartupTasks->mark("basic init done");
+
     initManagers(STAGE_LATE);
 
+    g_pStartupTasks->mark("late init done");
+
+    g_pStartupTasks->wait("system info");
+    Debug::log(LOG, "===== SYSTEM INFO: =====\n{}\n========================", startupSystemInfo);
+
     for (auto const& o : pendingOutputs) {
         onNewMonitor(o);
     }
@@ -589,6 +605,7 @@ void CCompositor::cleanup() {
     g_pHookSystem.reset();
     g_pXWaylandManager.reset();
     g_pPointerManager.reset();
+    g_pSelectionCacheManager.reset();
     g_pSeatManager.reset();
     g_pHyprCtl.reset();
     g_pEventLoopManager.reset();
@@ -596,6 +613,9 @@ void CCompositor::cleanup() {
     g_pDonationNagManager.reset();
     g_pANRManager.reset();
     g_pConfigWatcher.reset();
+    g_pFrameTracer.reset();
+    g_pFrameMetrics.reset();
+    g_pStartupTasks.reset();
 
     if (m_aqBackend)
         m_aqBackend.reset();
@@ -612,6 +632,12 @@ void CCompositor::cleanup() {
 void CCompositor::initManagers(eManagersInitStage stage) {
     switch (stage) {
         case STAGE_PRIORITY: {
+            Debug::log(LOG, "Creating the FrameTracer!");
+            g_pFrameTracer = makeUnique<CFrameTracer>();
+
+            Debug::log(LOG, "Creating the FrameMetrics!");
+            g_pFrameMetrics = makeUnique<CFrameMetrics>();
+
             Debug::log(LOG, "Creating the EventLoopManager!");
             g_pEventLoopManager = makeUnique<CEventLoopManager>(m_wlDisplay, m_wlEventLoop);
 
@@ -641,6 +667,15 @@ void CCompositor::initManagers(eManagersInitStage stage) {
 
             g_pConfigManager->init();
 
+            g_pStartupTasks->mark("config parsed");
+
+            // decoding and theme scanning doesn't need GL nor wayland, start it while the backend comes up
+            g_pStartupTasks->spawn("assets", [ASSETS = CHyprOpenGLImpl::startupAssets()] { CHyprOpenGLImpl::predecodeAssets(ASSETS); });
+            g_pStartupTasks->spawn("fonts", [] { CHyprOpenGLImpl::warmUpFonts(); });
+            g_pStartupTasks->spawn("cursor theme", [] { CCursorManager::preloadTheme(); });
+            // the first keyboards come with the backend, have their keymap compiled by then
+            CKeymapCache::prefetchForDevice("");
+
             Debug::log(LOG, "Creating the PointerManager!");
             g_pPointerManager = makeUnique<CPointerManager>();
 
@@ -656,6 +691,9 @@ void CCompositor::initManagers(eManagersInitStage stage) {
 
             Debug::log(LOG, "Creating the SeatManager!");
             g_pSeatManager = makeUnique<CSeatManager>();
+
+            Debug::log(LOG, "Creating the SelectionCacheManager!");
+            g_pSelectionCacheManager = makeUnique<CSelectionCacheManager>();
         } break;
         case STAGE_LATE: {
             Debug::log(LOG, "Creating CHyprCtl");
@@ -856,6 +894,7 @@ void CCompositor::removeWindowFromVectorSafe(PHLWINDOW pWindow) {
 
         std::erase_if(m_windows, [&](SP<CWindow>& el) { return el == pWindow; });
         std::erase_if(m_windowsFadingOut, [&](PHLWINDOWREF el) { return el.lock() == pWindow; });
+        invalidateWorkspaceWindows();
     }
 }
 
@@ -895,20 +934,20 @@ PHLWINDOW CCompositor::vectorToWindowUnified(const Vector2D& pos, uint8_t proper
                 if (special && !w->onSpecialWorkspace()) // because special floating may creep up into regular
                     continue;
 
-                if (!w->m_workspace)
+                if (!w->workspace())
                     continue;
 
                 const auto PWINDOWMONITOR = w->m_monitor.lock();
 
                 // to avoid focusing windows behind special workspaces from other monitors
-                if (!*PSPECIALFALLTHRU && PWINDOWMONITOR && PWINDOWMONITOR->m_activeSpecialWorkspace && w->m_workspace != PWINDOWMONITOR->m_activeSpecialWorkspace) {
+                if (!*PSPECIALFALLTHRU && PWINDOWMONITOR && PWINDOWMONITOR->m_activeSpecialWorkspace && w->workspace() != PWINDOWMONITOR->m_activeSpecialWorkspace) {
                     const auto BB = w->getWindowBoxUnified(properties);
                     if (BB.x >= PWINDOWMONITOR->m_position.x && BB.y >= PWINDOWMONITOR->m_position.y &&
                         BB.x + BB.width <= PWINDOWMONITOR->m_position.x + PWINDOWMONITOR->m_size.x && BB.y + BB.height <= PWINDOWMONITOR->m_position.y + PWINDOWMONITOR->m_size.y)
                         continue;
                 }
 
-                if (w->m_isFloating && w->m_isMapped && w->m_workspace->isVisible() && !w->isHidden() && !w->m_pinned && !w->m_windowData.noFocus.valueOrDefault() &&
+                if (w->m_isFloating && w->m_isMapped && w->workspace()->isVisible() && !w->isHidden() && !w->m_pinned && !w->m_windowData.noFocus.valueOrDefault() &&
                     w != pIgnoreWindow && (!aboveFullscreen || w->m_createdOverFullscreen)) {
                     // OR windows should add focus to parent
                     if (w->m_X11ShouldntFocus && !w->isX11OverrideRedirect())
@@ -962,7 +1001,7 @@ PHLWINDOW CCompositor::vectorToWindowUnified(const Vector2D& pos, uint8_t proper
             if (special != w->onSpecialWorkspace())
                 continue;
 
-            if (!w->m_workspace)
+            if (!w->workspace())
                 continue;
 
             if (!w->m_isX11 && !w->m_isFloating && w->m_isMapped && w->workspaceID() == WSPID && !w->isHidden() && !w->m_X11ShouldntFocus &&
@@ -976,7 +1015,7 @@ PHLWINDOW CCompositor::vectorToWindowUnified(const Vector2D& pos, uint8_t proper
             if (special != w->onSpecialWorkspace())
                 continue;
 
-            if (!w->m_workspace)
+            if (!w->workspace())
                 continue;
 
             if (!w->m_isFloating && w->m_isMapped && w->workspaceID() == WSPID && !w->isHidden() && !w->m_X11ShouldntFocus && !w->m_windowData.noFocus.valueOrDefault() &&
@@ -1136,12 +1175,12 @@ void CCompositor::focusWindow(PHLWINDOW pWindow, SP<CWLSurfaceResource> pSurface
         return;
 
     if (pWindow->m_pinned)
-        pWindow->m_workspace = m_lastMonitor->m_activeWorkspace;
+        pWindow->setWorkspace(m_lastMonitor->m_activeWorkspace);
 
     const auto PMONITOR = pWindow->m_monitor.lock();
 
-    if (!pWindow->m_workspace || !pWindow->m_workspace->isVisible()) {
-        const auto PWORKSPACE = pWindow->m_workspace;
+    if (!pWindow->workspace() || !pWindow->workspace()->isVisible()) {
+        const auto PWORKSPACE = pWindow->workspace();
         // This is to fix incorrect feedback on the focus history.
         PWORKSPACE->m_lastFocusedWindow = pWindow;
         if (m_lastMonitor->m_activeWorkspace)
@@ -1159,7 +1198,7 @@ void CCompositor::focusWindow(PHLWINDOW pWindow, SP<CWLSurfaceResource> pSurface
 
     /* If special fallthrough is enabled, this behavior will be disabled, as I have no better idea of nicely tracking which
        window focuses are "via keybinds" and which ones aren't. */
-    if (PMONITOR && PMONITOR->m_activeSpecialWorkspace && PMONITOR->m_activeSpecialWorkspace != pWindow->m_workspace && !pWindow->m_pinned && !*PSPECIALFALLTHROUGH)
+    if (PMONITOR && PMONITOR->m_activeSpecialWorkspace && PMONITOR->m_activeSpecialWorkspace != pWindow->workspace() && !pWindow->m_pinned && !*PSPECIALFALLTHROUGH)
         PMONITOR->setSpecialWorkspace(nullptr);
 
     // we need to make the PLASTWINDOW not equal to m_pLastWindow so that RENDERDATA is correct for an unfocused window
@@ -1427,6 +1466,35 @@ void CCompositor::changeWindowZOrder(PHLWINDOW pWindow, bool top) {
             moveToZ(it, top);
         }
     }
+
+    invalidateWorkspaceWindows();
+}
+
+void CCompositor::invalidateWorkspaceWindows() {
+    m_workspaceWindowsDirty = true;
+}
+
+void CCompositor::updateWorkspaceWindows() {
+    if (!m_workspaceWindowsDirty)
+        return;
+
+    m_workspaceWindowsDirty = false;
+
+    // a window can still point at a workspace that's gone from m_workspaces, clear those too
+    for (auto const& ws : m_workspaces) {
+        ws->m_windows.clear();
+    }
+
+    for (auto const& w : m_windows) {
+        if (w->workspace())
+            w->workspace()->m_windows.clear();
+    }
+
+    // m_windows is bottom to top, so are the lists
+    for (auto const& w : m_windows) {
+        if (w->workspace())
+            w->workspace()->m_windows.emplace_back(w);
+    }
 }
 
 void CCompositor::cleanupFadingOut(const MONITORID& monid) {
@@ -1528,7 +1596,7 @@ PHLWINDOW CCompositor::getWindowInDirection(PHLWINDOW pWindow, char dir) {
         return nullptr; // ??
 
     const auto WINDOWIDEALBB = pWindow->isFullscreen() ? CBox{PMONITOR->m_position, PMONITOR->m_size} : pWindow->getWindowIdealBoundingBoxIgnoreReserved();
-    const auto PWORKSPACE    = pWindow->m_workspace;
+    const auto PWORKSPACE    = pWindow->workspace();
 
     return getWindowInDirection(WINDOWIDEALBB, PWORKSPACE, dir, pWindow, pWindow->m_isFloating);
 }
@@ -1549,10 +1617,10 @@ PHLWINDOW CCompositor::getWindowInDirection(const CBox& box, PHLWORKSPACE pWorks
 
     if (!useVectorAngles) {
         for (auto const& w : m_windows) {
-            if (w == ignoreWindow || !w->m_workspace || !w->m_isMapped || w->isHidden() || (!w->isFullscreen() && w->m_isFloating) || !w->m_workspace->isVisible())
+            if (w == ignoreWindow || !w->workspace() || !w->m_isMapped || w->isHidden() || (!w->isFullscreen() && w->m_isFloating) || !w->workspace()->isVisible())
                 continue;
 
-            if (pWorkspace->m_monitor == w->m_monitor && pWorkspace != w->m_workspace)
+            if (pWorkspace->m_monitor == w->m_monitor && pWorkspace != w->workspace())
                 continue;
 
             if (pWorkspace->m_hasFullscreenWindow && !w->isFullscreen() && !w->m_createdOverFullscreen)
@@ -1638,10 +1706,10 @@ PHLWINDOW CCompositor::getWindowInDirection(const CBox& box, PHLWORKSPACE pWorks
         constexpr float THRESHOLD    = 0.3 * M_PI;
 
         for (auto const& w : m_windows) {
-            if (w == ignoreWindow || !w->m_isMapped || !w->m_workspace || w->isHidden() || (!w->isFullscreen() && !w->m_isFloating) || !w->m_workspace->isVisible())
+            if (w == ignoreWindow || !w->m_isMapped || !w->workspace() || w->isHidden() || (!w->isFullscreen() && !w->m_isFloating) || !w->workspace()->isVisible())
                 continue;
 
-            if (pWorkspace->m_monitor == w->m_monitor && pWorkspace != w->m_workspace)
+            if (pWorkspace->m_monitor == w->m_monitor && pWorkspace != w->workspace())
                 continue;
 
             if (pWorkspace->m_hasFullscreenWindow && !w->isFullscreen() && !w->m_createdOverFullscreen)
@@ -1675,7 +1743,7 @@ PHLWINDOW CCompositor::getWindowInDirection(const CBox& box, PHLWORKSPACE pWorks
 
 template <typename WINDOWPTR>
 static bool isWorkspaceMatches(WINDOWPTR pWindow, const WINDOWPTR w, bool anyWorkspace) {
-    return anyWorkspace ? w->m_workspace && w->m_workspace->isVisible() : w->m_workspace == pWindow->m_workspace;
+    return anyWorkspace ? w->workspace() && w->workspace()->isVisible() : w->workspace() == pWindow->workspace();
 }
 
 template <typename WINDOWPTR>
@@ -1899,7 +1967,7 @@ void CCompositor::updateWindowAnimatedDecorationValues(PHLWINDOW pWindow) {
     }
 
     // opacity
-    const auto PWORKSPACE = pWindow->m_workspace;
+    const auto PWORKSPACE = pWindow->workspace();
     if (pWindow->isEffectiveInternalFSMode(FSMODE_FULLSCREEN)) {
         *pWindow->m_activeInactiveAlpha = pWindow->m_windowData.alphaFullscreen.valueOrDefault().applyAlpha(*PFULLSCREENALPHA);
     } else {
@@ -1961,9 +2029,9 @@ void CCompositor::swapActiveWorkspaces(PHLMONITOR pMonitorA, PHLMONITOR pMonitor
     PWORKSPACEA->moveToMonitor(pMonitorB->m_id);
 
     for (auto const& w : m_windows) {
-        if (w->m_workspace == PWORKSPACEA) {
+        if (w->workspace() == PWORKSPACEA) {
             if (w->m_pinned) {
-                w->m_workspace = PWORKSPACEB;
+                w->setWorkspace(PWORKSPACEB);
                 continue;
             }
 
@@ -1986,9 +2054,9 @@ void CCompositor::swapActiveWorkspaces(PHLMONITOR pMonitorA, PHLMONITOR pMonitor
     PWORKSPACEB->moveToMonitor(pMonitorA->m_id);
 
     for (auto const& w : m_windows) {
-        if (w->m_workspace == PWORKSPACEB) {
+        if (w->workspace() == PWORKSPACEB) {
             if (w->m_pinned) {
-                w->m_workspace = PWORKSPACEA;
+                w->setWorkspace(PWORKSPACEA);
                 continue;
             }
 
@@ -2166,9 +2234,9 @@ void CCompositor::moveWorkspaceToMonitor(PHLWORKSPACE pWorkspace, PHLMONITOR pMo
     pWorkspace->moveToMonitor(pMonitor->m_id);
 
     for (auto const& w : m_windows) {
-        if (w->m_workspace == pWorkspace) {
+        if (w->workspace() == pWorkspace) {
             if (w->m_pinned) {
-                w->m_workspace = g_pCompositor->getWorkspaceByID(nextWorkspaceOnMonitorID);
+                w->setWorkspace(g_pCompositor->getWorkspaceByID(nextWorkspaceOnMonitorID));
                 continue;
             }
 
@@ -2258,7 +2326,7 @@ void CCompositor::updateFullscreenFadeOnWorkspace(PHLWORKSPACE pWorkspace) {
     const auto FULLSCREEN = pWorkspace->m_hasFullscreenWindow;
 
     for (auto const& w : g_pCompositor->m_windows) {
-        if (w->m_workspace == pWorkspace) {
+        if (w->workspace() == pWorkspace) {
 
             if (w->m_fadingOut || w->m_pinned || w->isFullscreen())
                 continue;
@@ -2310,7 +2378,7 @@ void CCompositor::setWindowFullscreenState(const PHLWINDOW PWINDOW, SFullscreenS
     state.client   = std::clamp(state.client, (eFullscreenMode)0, FSMODE_MAX);
 
     const auto            PMONITOR   = PWINDOW->m_monitor.lock();
-    const auto            PWORKSPACE = PWINDOW->m_workspace;
+    const auto            PWORKSPACE = PWINDOW->workspace();
 
     const eFullscreenMode CURRENT_EFFECTIVE_MODE = (eFullscreenMode)std::bit_floor((uint8_t)PWINDOW->m_fullscreenState.internal);
     const eFullscreenMode EFFECTIVE_MODE         = (eFullscreenMode)std::bit_floor((uint8_t)state.internal);
@@ -2362,7 +2430,7 @@ void CCompositor::setWindowFullscreenState(const PHLWINDOW PWINDOW, SFullscreenS
 
     // make all windows on the same workspace under the fullscreen window
     for (auto const& w : m_windows) {
-        if (w->m_workspace == PWORKSPACE && !w->isFullscreen() && !w->m_fadingOut && !w->m_pinned)
+        if (w->workspace() == PWORKSPACE && !w->isFullscreen() && !w->m_fadingOut && !w->m_pinned)
             w->m_createdOverFullscreen = false;
     }
 
@@ -2411,6 +2479,9 @@ void CCompositor::scheduleFrameForMonitor(PHLMONITOR pMonitor, IOutput::schedule
     if (pMonitor->m_renderingActive)
         pMonitor->m_pendingFrame = true;
 
+    if (g_pFrameTracer)
+        g_pFrameTracer->instant("scheduleFrame", TRACE_CATEGORY_RENDER, "monitor", pMonitor->m_id);
+
     pMonitor->m_output->scheduleFrame(reason);
 }
 
@@ -2427,7 +2498,7 @@ PHLWINDOW CCompositor::getWindowByRegex(const std::string& regexp_) {
         const bool FLOAT = regexp.starts_with("floating");
 
         for (auto const& w : m_windows) {
-            if (!w->m_isMapped || w->m_isFloating != FLOAT || w->m_workspace != m_lastWindow->m_workspace || w->isHidden())
+            if (!w->m_isMapped || w->m_isFloating != FLOAT || w->workspace() != m_lastWindow->workspace() || w->isHidden())
                 continue;
 
             return w;
@@ -2720,12 +2791,12 @@ void CCompositor::moveWindowToWorkspaceSafe(PHLWINDOW pWindow, PHLWORKSPACE pWor
     if (pWindow->m_pinned && pWorkspace->m_isSpecialWorkspace)
         return;
 
-    if (pWindow->m_workspace == pWorkspace)
+    if (pWindow->workspace() == pWorkspace)
         return;
 
     const bool FULLSCREEN     = pWindow->isFullscreen();
     const auto FULLSCREENMODE = pWindow->m_fullscreenState.internal;
-    const bool WASVISIBLE     = pWindow->m_workspace && pWindow->m_workspace->isVisible();
+    const bool WASVISIBLE     = pWindow->workspace() && pWindow->workspace()->isVisible();
 
     if (FULLSCREEN)
         setWindowFullscreenInternal(pWindow, FSMODE_NONE);
@@ -2789,11 +2860,11 @@ void CCompositor::moveWindowToWorkspaceSafe(PHLWINDOW pWindow, PHLWORKSPACE pWor
         setWindowFullscreenInternal(pWindow, FULLSCREENMODE);
 
     pWorkspace->updateWindows();
-    if (pWindow->m_workspace)
-        pWindow->m_workspace->updateWindows();
+    if (pWindow->workspace())
+        pWindow->workspace()->updateWindows();
     g_pCompositor->updateSuspendedStates();
 
-    if (!WASVISIBLE && pWindow->m_workspace && pWindow->m_workspace->isVisible()) {
+    if (!WASVISIBLE && pWindow->workspace() && pWindow->workspace()->isVisible()) {
         pWindow->m_movingFromWorkspaceAlpha->setValueAndWarp(0.F);
         *pWindow->m_movingFromWorkspaceAlpha = 1.F;
     }
@@ -2801,7 +2872,7 @@ void CCompositor::moveWindowToWorkspaceSafe(PHLWINDOW pWindow, PHLWORKSPACE pWor
 
 PHLWINDOW CCompositor::getForceFocus() {
     for (auto const& w : m_windows) {
-        if (!w->m_isMapped || w->isHidden() || !w->m_workspace || !w->m_workspace->isVisible())
+        if (!w->m_isMapped || w->isHidden() || !w->workspace() || !w->workspace()->isVisible())
             continue;
 
         if (!w->m_stayFocused)
@@ -2971,7 +3042,7 @@ void CCompositor::updateSuspendedStates() {
         if (!w->m_isMapped)
             continue;
 
-        w->setSuspended(w->isHidden() || !w->m_workspace || !w->m_workspace->isVisible());
+        w->setSuspended(w->isHidden() || !w->workspace() || !w->workspace()->isVisible());
     }
 }
 
@@ -3084,7 +3155,7 @@ void CCompositor::ensurePersistentWorkspacesPresent(const std::vector<SWorkspace
 
         PHLWORKSPACE PWORKSPACE = nullptr;
         if (pWorkspace) {
-            if (pWorkspace->matchesStaticSelector(rule.workspaceString))
+            if (pWorkspace->matchesStaticSelector(rule.workspaceSelector))
                 PWORKSPACE = pWorkspace;
             else
                 continue;
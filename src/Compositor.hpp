@@ -100,6 +100,8 @@ class CCompositor {
     PHLWINDOW              getUrgentWindow();
     bool                   isWindowActive(PHLWINDOW);
     void                   changeWindowZOrder(PHLWINDOW, bool);
+    void                   invalidateWorkspaceWindows();
+    void                   updateWorkspaceWindows();
     void                   cleanupFadingOut(const MONITORID& monid);
     PHLWINDOW              getWindowInDirection(PHLWINDOW, char);
     PHLWINDOW              getWindowInDirection(const CBox& box, PHLWORKSPACE pWorkspace, char dir, PHLWINDOW ignoreWindow = nullptr, bool useVectorAngles = false);
@@ -168,6 +170,9 @@ class CCompositor {
     uint64_t         m_iHyprlandPID    = 0;
     wl_event_source* m_critSigSource   = nullptr;
     rlimit           m_sOriginalNofile = {};
+
+    // CWorkspace::windows() lists are stale, rebuilt on the next read
+    bool m_workspaceWindowsDirty = true;
 };
 
 inline UP<CCompositor> g_pCompositor;
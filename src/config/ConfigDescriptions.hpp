@@ -458,6 +458,13 @@ inline static const std::vector<SConfigOptionDescription> CONFIG_OPTIONS = {
         .type        = CONFIG_OPTION_BOOL,
         .data        = SConfigOptionDescription::SBoolData{false},
     },
+    SConfigOptionDescription{
+        .value       = "input:motion_coalescing",
+        .description = "For high polling rate mice: resolve focus and send pointer motion to apps at most once every this many ms, and before every frame. The cursor and relative "
+                       "motion still follow every event, buttons, scrolling and keys always see the latest position. 0 disables.",
+        .type        = CONFIG_OPTION_INT,
+        .data        = SConfigOptionDescription::SRangeData{0, 0, 20},
+    },
     SConfigOptionDescription{
         .value       = "input:left_handed",
         .description = "Switches RMB and LMB",
@@ -1259,6 +1266,30 @@ inline static const std::vector<SConfigOptionDescription> CONFIG_OPTIONS = {
         .type        = CONFIG_OPTION_INT,
         .data        = SConfigOptionDescription::SRangeData{1, 1, 10},
     },
+    SConfigOptionDescription{
+        .value       = "misc:selection_cache",
+        .description = "keep a copy of the clipboard and primary selection in the compositor, so pastes don't wait on the app that copied. Clipboard contents are held in memory.",
+        .type        = CONFIG_OPTION_BOOL,
+        .data        = SConfigOptionDescription::SBoolData{false},
+    },
+    SConfigOptionDescription{
+        .value       = "misc:selection_cache_mimes",
+        .description = "comma-separated mime types misc:selection_cache copies when a selection is set, in order of preference",
+        .type        = CONFIG_OPTION_STRING_LONG,
+        .data        = SConfigOptionDescription::SStringData{"text/plain;charset=utf-8,text/plain,UTF8_STRING,STRING,TEXT,text/uri-list"},
+    },
+    SConfigOptionDescription{
+        .value       = "misc:selection_cache_max_size",
+        .description = "KiB misc:selection_cache may hold in total, data over it is left to the app that copied",
+        .type        = CONFIG_OPTION_INT,
+        .data        = SConfigOptionDescription::SRangeData{16384, 64, 262144},
+    },
+    SConfigOptionDescription{
+        .value       = "misc:selection_cache_max_age",
+        .description = "seconds misc:selection_cache keeps a selection for, 0 for as long as it's set",
+        .type        = CONFIG_OPTION_INT,
+        .data        = SConfigOptionDescription::SRangeData{300, 0, 3600},
+    },
 
     /*
      * binds:
@@ -1450,6 +1481,19 @@ inline static const std::vector<SConfigOptionDescription> CONFIG_OPTIONS = {
         .type        = CONFIG_OPTION_BOOL,
         .data        = SConfigOptionDescription::SBoolData{true},
     },
+    SConfigOptionDescription{
+        .value       = "render:occlusion_culling",
+        .description = "Skip tiled windows that are fully covered by opaque windows above them before building their render elements",
+        .type        = CONFIG_OPTION_BOOL,
+        .data        = SConfigOptionDescription::SBoolData{true},
+    },
+    SConfigOptionDescription{
+        .value       = "render:frame_scheduling",
+        .description = "Delay rendering until just before the predicted deadline of the next vblank to lower latency. Never applies to VRR, tearing or video content. "
+                       "0 - off, 1 - on, 2 - auto (only for a fullscreen client with content type 'game')",
+        .type        = CONFIG_OPTION_INT,
+        .data        = SConfigOptionDescription::SRangeData{.value = 0, .min = 0, .max = 2},
+    },
 
     /*
      * cursor:
@@ -411,26 +411,31 @@ static Hyprlang::CParseResult handlePermission(const char* c, const char* v) {
 
 void CConfigManager::registerConfigVar(const char* name, const Hyprlang::INT& val) {
     m_configValueNumber++;
+    m_configValueNames.emplace_back(name);
     m_config->addConfigValue(name, val);
 }
 
 void CConfigManager::registerConfigVar(const char* name, const Hyprlang::FLOAT& val) {
     m_configValueNumber++;
+    m_configValueNames.emplace_back(name);
     m_config->addConfigValue(name, val);
 }
 
 void CConfigManager::registerConfigVar(const char* name, const Hyprlang::VEC2& val) {
     m_configValueNumber++;
+    m_configValueNames.emplace_back(name);
     m_config->addConfigValue(name, val);
 }
 
 void CConfigManager::registerConfigVar(const char* name, const Hyprlang::STRING& val) {
     m_configValueNumber++;
+    m_configValueNames.emplace_back(name);
     m_config->addConfigValue(name, val);
 }
 
 void CConfigManager::registerConfigVar(const char* name, Hyprlang::CUSTOMTYPE&& val) {
     m_configValueNumber++;
+    m_configValueNames.emplace_back(name);
     m_config->addConfigValue(name, std::move(val));
 }
 
@@ -496,6 +501,10 @@ CConfigManager::CConfigManager() {
     registerConfigVar("misc:lockdead_screen_delay", Hyprlang::INT{1000});
     registerConfigVar("misc:enable_anr_dialog", Hyprlang::INT{1});
     registerConfigVar("misc:anr_missed_pings", Hyprlang::INT{1});
+    registerConfigVar("misc:selection_cache", Hyprlang::INT{0});
+    registerConfigVar("misc:selection_cache_mimes", {"text/plain;charset=utf-8,text/plain,UTF8_STRING,STRING,TEXT,text/uri-list"});
+    registerConfigVar("misc:selection_cache_max_size", Hyprlang::INT{16384});
+    registerConfigVar("misc:selection_cache_max_age", Hyprlang::INT{300});
 
     registerConfigVar("group:insert_after_current", Hyprlang::INT{1});
     registerConfigVar("group:focus_removed_window", Hyprlang::INT{1});
@@ -631,6 +640,7 @@ CConfigManager::CConfigManager() {
     registerConfigVar("input:numlock_by_default", Hyprlang::INT{0});
     registerConfigVar("input:resolve_binds_by_sym", Hyprlang::INT{0});
     registerConfigVar("input:force_no_accel", Hyprlang::INT{0});
+    registerConfigVar("input:motion_coalescing", Hyprlang::INT{0});
     registerConfigVar("input:float_switch_override_focus", Hyprlang::INT{1});
     registerConfigVar("input:left_handed", Hyprlang::INT{0});
     registerConfigVar("input:scroll_method", {STRVAL_EMPTY});
@@ -740,6 +750,8 @@ CConfigManager::CConfigManager() {
     registerConfigVar("render:cm_fs_passthrough", Hyprlang::INT{2});
     registerConfigVar("render:cm_enabled", Hyprlang::INT{1});
     registerConfigVar("render:send_content_type", Hyprlang::INT{1});
+    registerConfigVar("render:occlusion_culling", Hyprlang::INT{1});
+    registerConfigVar("render:frame_scheduling", Hyprlang::INT{0});
 
     registerConfigVar("ecosystem:no_update_news", Hyprlang::INT{0});
     registerConfigVar("ecosystem:no_donation_nag", Hyprlang::INT{0});
@@ -909,13 +921,214 @@ std::string CConfigManager::getErrors() {
 }
 
 void CConfigManager::reload() {
+    m_reloadScheduled = false;
+
     EMIT_HOOK_EVENT("preConfigReload", nullptr);
+
+    // what's running now, so only what the new config changes gets redone
+    const auto PREVVALUES       = m_isFirstLaunch ? std::unordered_map<std::string, std::string>{} : snapshotConfigValues();
+    const auto PREVMONITORRULES = m_monitorRuleInputs;
+    const auto PREVRULES        = m_ruleInputs;
+    const bool HADDEVICES       = !m_config->listKeysForSpecialCategory("device").empty();
+
     setDefaultAnimationVars();
     resetHLConfig();
     m_configCurrentPath                   = getMainConfigPath();
     const auto ERR                        = m_config->parse();
     m_lastConfigVerificationWasSuccessful = !ERR.error;
-    postConfigReload(ERR);
+
+    uint16_t steps = std::exchange(m_pendingReloadSteps, RELOAD_NONE);
+
+    if (m_isFirstLaunch)
+        steps = RELOAD_ALL;
+    else {
+        const auto VALUES = snapshotConfigValues();
+
+        for (auto const& [name, value] : VALUES) {
+            const auto IT = PREVVALUES.find(name);
+            if (IT == PREVVALUES.end() || IT->second != value)
+                steps |= reloadStepsForOption(name);
+        }
+
+        // values of an unloaded plugin
+        for (auto const& [name, value] : PREVVALUES) {
+            if (!VALUES.contains(name))
+                steps |= reloadStepsForOption(name);
+        }
+
+        if (m_monitorRuleInputs != PREVMONITORRULES)
+            steps |= RELOAD_MONITORS | RELOAD_LAYOUT;
+
+        if (m_ruleInputs != PREVRULES)
+            steps |= RELOAD_RULES | RELOAD_LAYOUT | RELOAD_DECORATIONS;
+
+        // device blocks aren't diffed, with any around input is always reapplied
+        if (HADDEVICES || !m_config->listKeysForSpecialCategory("device").empty())
+            steps |= RELOAD_INPUT;
+    }
+
+    postConfigReload(ERR, steps);
+}
+
+void CConfigManager::scheduleReload() {
+    m_reloadScheduled = true;
+    queueReloadFlush();
+}
+
+void CConfigManager::queueReloadSteps(uint16_t steps) {
+    if (steps == RELOAD_NONE)
+        return;
+
+    m_pendingReloadSteps |= steps;
+    queueReloadFlush();
+}
+
+void CConfigManager::queueReloadFlush() {
+    if (m_reloadFlushQueued)
+        return;
+
+    m_reloadFlushQueued = true;
+    g_pEventLoopManager->doLater([] {
+        if (!g_pConfigManager)
+            return;
+
+        g_pConfigManager->m_reloadFlushQueued = false;
+        g_pConfigManager->flushPendingReload();
+    });
+}
+
+void CConfigManager::flushPendingReload() {
+    // a full reload takes the queued steps with it
+    if (m_reloadScheduled)
+        reload();
+
+    if (m_pendingReloadSteps == RELOAD_NONE)
+        return;
+
+    applyReloadSteps(std::exchange(m_pendingReloadSteps, RELOAD_NONE));
+}
+
+// options and keywords that need less (or other things) than their section below
+static const std::unordered_map<std::string, uint16_t> OPTION_RELOAD_STEPS = {
+    // only read while drawing
+    {"decoration:rounding", RELOAD_REPAINT},
+    {"decoration:rounding_power", RELOAD_REPAINT},
+    {"decoration:dim_special", RELOAD_REPAINT},
+    {"decoration:dim_around", RELOAD_REPAINT},
+    {"decoration:border_part_of_window", RELOAD_REPAINT},
+    {"cursor:zoom_factor", RELOAD_REPAINT},
+    {"cursor:zoom_rigid", RELOAD_REPAINT},
+    // animated window values, the layout doesn't care
+    {"decoration:active_opacity", RELOAD_DECORATIONS | RELOAD_REPAINT},
+    {"decoration:inactive_opacity", RELOAD_DECORATIONS | RELOAD_REPAINT},
+    {"decoration:fullscreen_opacity", RELOAD_DECORATIONS | RELOAD_REPAINT},
+    {"decoration:dim_inactive", RELOAD_DECORATIONS | RELOAD_REPAINT},
+    {"decoration:dim_strength", RELOAD_DECORATIONS | RELOAD_REPAINT},
+    {"general:col.active_border", RELOAD_DECORATIONS | RELOAD_REPAINT},
+    {"general:col.inactive_border", RELOAD_DECORATIONS | RELOAD_REPAINT},
+    {"general:col.nogroup_border", RELOAD_DECORATIONS | RELOAD_REPAINT},
+    {"general:col.nogroup_border_active", RELOAD_DECORATIONS | RELOAD_REPAINT},
+    // what the layout is computed from
+    {"general:border_size", RELOAD_LAYOUT | RELOAD_DECORATIONS | RELOAD_REPAINT},
+    {"general:no_border_on_floating", RELOAD_DECORATIONS | RELOAD_REPAINT},
+    {"general:gaps_in", RELOAD_LAYOUT},
+    {"general:gaps_out", RELOAD_LAYOUT},
+    {"general:gaps_workspaces", RELOAD_LAYOUT},
+    {"general:layout", RELOAD_LAYOUT},
+    {"decoration:screen_shader", RELOAD_SHADER},
+    {"misc:vrr", RELOAD_MONITORS},
+    // keywords that aren't values, rules get picked up as windows change
+    {"monitor", RELOAD_MONITORS | RELOAD_LAYOUT},
+    {"workspace", RELOAD_LAYOUT | RELOAD_REPAINT},
+    {"windowrule", RELOAD_LAYOUT | RELOAD_REPAINT},
+    {"windowrulev2", RELOAD_LAYOUT | RELOAD_REPAINT},
+    {"layerrule", RELOAD_REPAINT},
+    {"blurls", RELOAD_REPAINT},
+    {"source", RELOAD_ALL},
+};
+
+// first match wins, so specific prefixes go above their section
+static const std::vector<std::pair<std::string, uint16_t>> SECTION_RELOAD_STEPS = {
+    {"general:snap:", RELOAD_NONE},
+    {"general:", RELOAD_LAYOUT | RELOAD_DECORATIONS},
+    {"decoration:blur:", RELOAD_REPAINT},
+    {"decoration:", RELOAD_DECORATIONS | RELOAD_REPAINT},
+    {"group:col.", RELOAD_DECORATIONS | RELOAD_GROUPBAR | RELOAD_REPAINT},
+    {"group:groupbar:", RELOAD_LAYOUT | RELOAD_DECORATIONS | RELOAD_GROUPBAR | RELOAD_REPAINT},
+    {"group:", RELOAD_NONE},
+    {"dwindle:", RELOAD_LAYOUT},
+    {"master:", RELOAD_LAYOUT},
+    {"input:", RELOAD_INPUT},
+    {"device", RELOAD_INPUT},
+    {"misc:", RELOAD_SHADER | RELOAD_DECORATIONS},
+    {"render:", RELOAD_MONITORS},
+    {"experimental:", RELOAD_MONITORS},
+    // what plugin values usually feed, plugins get configReloaded for the rest
+    {"plugin:", RELOAD_LAYOUT | RELOAD_DECORATIONS | RELOAD_REPAINT},
+    // read where they're used
+    {"animations:", RELOAD_NONE},
+    {"animation", RELOAD_NONE},
+    {"bezier", RELOAD_NONE},
+    {"bind", RELOAD_NONE},
+    {"unbind", RELOAD_NONE},
+    {"submap", RELOAD_NONE},
+    {"exec", RELOAD_NONE},
+    {"env", RELOAD_NONE},
+    {"permission", RELOAD_NONE},
+    {"gestures:", RELOAD_NONE},
+    {"cursor:", RELOAD_NONE},
+    {"debug:", RELOAD_NONE},
+    {"xwayland:", RELOAD_NONE},
+    {"opengl:", RELOAD_NONE},
+    {"ecosystem:", RELOAD_NONE},
+    {"autogenerated", RELOAD_NONE},
+};
+
+uint16_t CConfigManager::reloadStepsForOption(const std::string& name) {
+    if (const auto IT = OPTION_RELOAD_STEPS.find(name); IT != OPTION_RELOAD_STEPS.end())
+        return IT->second;
+
+    for (auto const& [section, steps] : SECTION_RELOAD_STEPS) {
+        if (name.starts_with(section))
+            return steps;
+    }
+
+    // not in the tables, don't guess
+    return RELOAD_ALL;
+}
+
+std::unordered_map<std::string, std::string> CConfigManager::snapshotConfigValues() {
+    std::unordered_map<std::string, std::string> values;
+
+    auto                                         snapshot = [&](const std::string& name) {
+        const auto VAR = getHyprlangConfigValuePtr(name);
+        if (!VAR)
+            return;
+
+        const auto VAL  = VAR->getValue();
+        const auto TYPE = std::type_index(VAL.type());
+
+        if (TYPE == typeid(Hyprlang::INT))
+            values[name] = std::to_string(std::any_cast<Hyprlang::INT>(VAL));
+        else if (TYPE == typeid(Hyprlang::FLOAT))
+            values[name] = std::to_string(std::any_cast<Hyprlang::FLOAT>(VAL));
+        else if (TYPE == typeid(Hyprlang::VEC2))
+            values[name] = std::format("{} {}", std::any_cast<Hyprlang::VEC2>(VAL).x, std::any_cast<Hyprlang::VEC2>(VAL).y);
+        else if (TYPE == typeid(Hyprlang::STRING))
+            values[name] = std::any_cast<Hyprlang::STRING>(VAL);
+        else if (TYPE == typeid(void*))
+            values[name] = ((ICustomConfigValueData*)std::any_cast<void*>(VAL))->toString();
+    };
+
+    for (auto const& name : m_configValueNames) {
+        snapshot(name);
+    }
+
+    for (auto const& v : m_pluginVariables) {
+        snapshot(v.name);
+    }
+
+    return values;
 }
 
 std::string CConfigManager::verify() {
@@ -982,7 +1195,10 @@ std::optional<std::string> CConfigManager::resetHLConfig() {
 
     m_mAdditionalReservedAreas.clear();
     m_blurLSNamespaces.clear();
+    m_monitorRuleInputs.clear();
+    m_ruleInputs.clear();
     m_workspaceRules.clear();
+    CWorkspaceSelector::clearCache();
     setDefaultAnimationVars(); // reset anims
     m_declaredPlugins.clear();
     m_layerRules.clear();
@@ -1005,30 +1221,13 @@ void CConfigManager::updateWatcher() {
     g_pConfigWatcher->setWatchList(*PDISABLEAUTORELOAD ? std::vector<std::string>{} : m_configPaths);
 }
 
-void CConfigManager::postConfigReload(const Hyprlang::CParseResult& result) {
+void CConfigManager::postConfigReload(const Hyprlang::CParseResult& result, uint16_t steps) {
     static const auto PENABLEEXPLICIT     = CConfigValue<Hyprlang::INT>("render:explicit_sync");
     static int        prevEnabledExplicit = *PENABLEEXPLICIT;
 
     updateWatcher();
 
-    for (auto const& w : g_pCompositor->m_windows) {
-        w->uncacheWindowDecos();
-    }
-
-    for (auto const& m : g_pCompositor->m_monitors)
-        g_pLayoutManager->getCurrentLayout()->recalculateMonitor(m->m_id);
-
-    // Update the keyboard layout to the cfg'd one if this is not the first launch
-    if (!m_isFirstLaunch) {
-        g_pInputManager->setKeyboardLayout();
-        g_pInputManager->setPointerConfigs();
-        g_pInputManager->setTouchDeviceConfigs();
-        g_pInputManager->setTabletConfigs();
-
-        g_pHyprOpenGL->m_bReloadScreenShader = true;
-
-        g_pHyprOpenGL->ensureBackgroundTexturePresence();
-    }
+    Debug::log(LOG, "Config reloaded, redoing steps {:x}", steps);
 
     // parseError will be displayed next frame
 
@@ -1049,17 +1248,6 @@ void CConfigManager::postConfigReload(const Hyprlang::CParseResult& result) {
     else
         g_pHyprError->destroy();
 
-    // Set the modes for all monitors as we configured them
-    // not on first launch because monitors might not exist yet
-    // and they'll be taken care of in the newMonitor event
-    // ignore if nomonitorreload is set
-    if (!m_isFirstLaunch && !m_noMonitorReload) {
-        // check
-        performMonitorReload();
-        ensureMonitorStatus();
-        ensureVRR();
-    }
-
 #ifndef NO_XWAYLAND
     const auto PENABLEXWAYLAND     = std::any_cast<Hyprlang::INT>(m_config->getConfigValue("xwayland:enabled"));
     g_pCompositor->m_wantsXwayland = PENABLEXWAYLAND;
@@ -1073,22 +1261,8 @@ void CConfigManager::postConfigReload(const Hyprlang::CParseResult& result) {
         g_pCompositor->m_wantsXwayland = PENABLEXWAYLAND;
 #endif
 
-    if (!m_isFirstLaunch && !g_pCompositor->m_unsafeState)
-        refreshGroupBarGradients();
-
-    // Updates dynamic window and workspace rules
-    for (auto const& w : g_pCompositor->m_workspaces) {
-        if (w->inert())
-            continue;
-        w->updateWindows();
-        w->updateWindowData();
-    }
-
-    // Update window border colors
-    g_pCompositor->updateAllWindowsAnimatedDecorationValues();
-
-    // update layout
-    g_pLayoutManager->switchToLayout(std::any_cast<Hyprlang::STRING>(m_config->getConfigValue("general:layout")));
+    // a reload always repaints, it's cheap and whatever changed should show up
+    applyReloadSteps(steps | RELOAD_REPAINT);
 
     // manual crash
     if (std::any_cast<Hyprlang::INT>(m_config->getConfigValue("debug:manual_crash")) && !m_manualCrashInitiated) {
@@ -1106,20 +1280,6 @@ void CConfigManager::postConfigReload(const Hyprlang::CParseResult& result) {
 
     Debug::m_coloredLogs = reinterpret_cast<int64_t* const*>(m_config->getConfigValuePtr("debug:colored_stdout_logs")->getDataStaticPtr());
 
-    for (auto const& m : g_pCompositor->m_monitors) {
-        // mark blur dirty
-        g_pHyprOpenGL->markBlurDirtyForMonitor(m);
-
-        g_pCompositor->scheduleFrameForMonitor(m);
-
-        // Force the compositor to fully re-render all monitors
-        m->m_forceFullFrames = 2;
-
-        // also force mirrors, as the aspect ratio could've changed
-        for (auto const& mirror : m->m_mirrors)
-            mirror->m_forceFullFrames = 3;
-    }
-
     // Reset no monitor reload
     m_noMonitorReload = false;
 
@@ -1135,11 +1295,84 @@ void CConfigManager::postConfigReload(const Hyprlang::CParseResult& result) {
         g_pEventManager->postEvent(SHyprIPCEvent{"configreloaded", ""});
 }
 
+void CConfigManager::applyReloadSteps(uint16_t steps) {
+    if (steps & RELOAD_DECORATIONS) {
+        for (auto const& w : g_pCompositor->m_windows) {
+            w->uncacheWindowDecos();
+        }
+    }
+
+    if (steps & RELOAD_LAYOUT) {
+        for (auto const& m : g_pCompositor->m_monitors)
+            g_pLayoutManager->getCurrentLayout()->recalculateMonitor(m->m_id);
+    }
+
+    // not on first launch, devices and monitors might not exist yet and are set up as they appear
+    if (!m_isFirstLaunch) {
+        if (steps & RELOAD_INPUT) {
+            g_pInputManager->setKeyboardLayout();
+            g_pInputManager->setPointerConfigs();
+            g_pInputManager->setTouchDeviceConfigs();
+            g_pInputManager->setTabletConfigs();
+        }
+
+        if (steps & RELOAD_SHADER) {
+            g_pHyprOpenGL->m_bReloadScreenShader = true;
+
+            g_pHyprOpenGL->ensureBackgroundTexturePresence();
+        }
+
+        // ignore if nomonitorreload is set
+        if ((steps & RELOAD_MONITORS) && !m_noMonitorReload) {
+            performMonitorReload();
+            ensureMonitorStatus();
+            ensureVRR();
+        }
+
+        if ((steps & RELOAD_GROUPBAR) && !g_pCompositor->m_unsafeState)
+            refreshGroupBarGradients();
+    }
+
+    // Updates dynamic window and workspace rules
+    if (steps & RELOAD_RULES) {
+        for (auto const& w : g_pCompositor->m_workspaces) {
+            if (w->inert())
+                continue;
+            w->updateWindows();
+            w->updateWindowData();
+        }
+    }
+
+    // Update window border colors
+    if (steps & RELOAD_DECORATIONS)
+        g_pCompositor->updateAllWindowsAnimatedDecorationValues();
+
+    // update layout
+    if (steps & RELOAD_LAYOUT)
+        g_pLayoutManager->switchToLayout(std::any_cast<Hyprlang::STRING>(m_config->getConfigValue("general:layout")));
+
+    if (steps & RELOAD_REPAINT) {
+        for (auto const& m : g_pCompositor->m_monitors) {
+            // mark blur dirty
+            g_pHyprOpenGL->markBlurDirtyForMonitor(m);
+
+            g_pCompositor->scheduleFrameForMonitor(m);
+
+            // Force the compositor to fully re-render all monitors
+            m->m_forceFullFrames = 2;
+
+            // also force mirrors, as the aspect ratio could've changed
+            for (auto const& mirror : m->m_mirrors)
+                mirror->m_forceFullFrames = 3;
+        }
+    }
+}
+
 void CConfigManager::init() {
 
     g_pConfigWatcher->setOnChange([this](const CConfigWatcher::SConfigWatchEvent& e) {
         Debug::log(LOG, "CConfigManager: file {} modified, reloading", e.file);
-        reload();
+        scheduleReload();
     });
 
     const std::string CONFIGPATH = getMainConfigPath();
@@ -1286,7 +1519,7 @@ SMonitorRule CConfigManager::getMonitorRuleFor(const PHLMONITOR PMONITOR) {
 SWorkspaceRule CConfigManager::getWorkspaceRuleFor(PHLWORKSPACE pWorkspace) {
     SWorkspaceRule mergedRule{};
     for (auto const& rule : m_workspaceRules) {
-        if (!pWorkspace->matchesStaticSelector(rule.workspaceString))
+        if (!pWorkspace->matchesStaticSelector(rule.workspaceSelector))
             continue;
 
         mergedRule = mergeWorkspaceRules(mergedRule, rule);
@@ -1300,8 +1533,10 @@ SWorkspaceRule CConfigManager::mergeWorkspaceRules(const SWorkspaceRule& rule1,
 
     if (rule1.monitor.empty())
         mergedRule.monitor = rule2.monitor;
-    if (rule1.workspaceString.empty())
-        mergedRule.workspaceString = rule2.workspaceString;
+    if (rule1.workspaceString.empty()) {
+        mergedRule.workspaceString   = rule2.workspaceString;
+        mergedRule.workspaceSelector = rule2.workspaceSelector;
+    }
     if (rule1.workspaceName.empty())
         mergedRule.workspaceName = rule2.workspaceName;
     if (rule1.workspaceId == WORKSPACE_INVALID)
@@ -1426,8 +1661,8 @@ std::vector<SP<CWindowRule>> CConfigManager::getMatchingRules(PHLWINDOW pWindow,
                 }
 
                 if (!rule->m_onWorkspace.empty()) {
-                    const auto PWORKSPACE = pWindow->m_workspace;
-                    if (!PWORKSPACE || !PWORKSPACE->matchesStaticSelector(rule->m_onWorkspace))
+                    const auto PWORKSPACE = pWindow->workspace();
+                    if (!PWORKSPACE || !PWORKSPACE->matchesStaticSelector(rule->m_onWorkspaceSelector))
                         continue;
                 }
 
@@ -1445,7 +1680,7 @@ std::vector<SP<CWindowRule>> CConfigManager::getMatchingRules(PHLWINDOW pWindow,
                 }
 
                 if (!rule->m_workspace.empty()) {
-                    const auto PWORKSPACE = pWindow->m_workspace;
+                    const auto PWORKSPACE = pWindow->workspace();
 
                     if (!PWORKSPACE)
                         continue;
@@ -1951,6 +2186,7 @@ static bool parseModeLine(const std::string& modeline, drmModeModeInfo& mode) {
 }
 
 std::optional<std::string> CConfigManager::handleMonitor(const std::string& command, const std::string& args) {
+    m_monitorRuleInputs += command + "=" + args + "\n";
 
     // get the monitor config
     SMonitorRule newrule;
@@ -2141,10 +2377,11 @@ std::optional<std::string> CConfigManager::handleMonitor(const std::string& comm
             const auto& [id, name] = getWorkspaceIDNameFromString(ARGS[argno + 1]);
 
             SWorkspaceRule wsRule;
-            wsRule.monitor         = newrule.name;
-            wsRule.workspaceString = ARGS[argno + 1];
-            wsRule.workspaceId     = id;
-            wsRule.workspaceName   = name;
+            wsRule.monitor           = newrule.name;
+            wsRule.workspaceString   = ARGS[argno + 1];
+            wsRule.workspaceSelector = CWorkspaceSelector{wsRule.workspaceString};
+            wsRule.workspaceId       = id;
+            wsRule.workspaceName     = name;
 
             m_workspaceRules.emplace_back(wsRule);
             argno++;
@@ -2404,6 +2641,8 @@ std::optional<std::string> CConfigManager::handleUnbind(const std::string& comma
 }
 
 std::optional<std::string> CConfigManager::handleWindowRule(const std::string& command, const std::string& value) {
+    m_ruleInputs += command + "=" + value + "\n";
+
     const auto RULE  = trim(value.substr(0, value.find_first_of(',')));
     const auto VALUE = value.substr(value.find_first_of(',') + 1);
 
@@ -2538,8 +2777,10 @@ std::optional<std::string> CConfigManager::handleWindowRule(const std::string& c
     if (FOCUSPOS != std::string::npos)
         rule->m_focus = extract(FOCUSPOS + 6) == "1" ? 1 : 0;
 
-    if (ONWORKSPACEPOS != std::string::npos)
-        rule->m_onWorkspace = extract(ONWORKSPACEPOS + 12);
+    if (ONWORKSPACEPOS != std::string::npos) {
+        rule->m_onWorkspace         = extract(ONWORKSPACEPOS + 12);
+        rule->m_onWorkspaceSelector = CWorkspaceSelector{rule->m_onWorkspace};
+    }
 
     if (CONTENTTYPEPOS != std::string::npos)
         rule->m_contentType = extract(CONTENTTYPEPOS + 8);
@@ -2609,6 +2850,8 @@ std::optional<std::string> CConfigManager::handleWindowRule(const std::string& c
 }
 
 std::optional<std::string> CConfigManager::handleLayerRule(const std::string& command, const std::string& value) {
+    m_ruleInputs += command + "=" + value + "\n";
+
     const auto RULE  = trim(value.substr(0, value.find_first_of(',')));
     const auto VALUE = trim(value.substr(value.find_first_of(',') + 1));
 
@@ -2675,6 +2918,8 @@ std::optional<std::string> CConfigManager::handleBlurLS(const std::string& comma
 }
 
 std::optional<std::string> CConfigManager::handleWorkspaceRules(const std::string& command, const std::string& value) {
+    m_ruleInputs += command + "=" + value + "\n";
+
     // This can either be the monitor or the workspace identifier
     const auto FIRST_DELIM = value.find_first_of(',');
 
@@ -2684,7 +2929,8 @@ std::optional<std::string> CConfigManager::handleWorkspaceRules(const std::strin
 
     auto           rules = value.substr(FIRST_DELIM + 1);
     SWorkspaceRule wsRule;
-    wsRule.workspaceString = first_ident;
+    wsRule.workspaceString   = first_ident;
+    wsRule.workspaceSelector = CWorkspaceSelector{first_ident};
     // if (id == WORKSPACE_INVALID) {
     //     // it could be the monitor. If so, second value MUST be
     //     // the workspace.
@@ -27,9 +27,24 @@
 
 #define HANDLE void*
 
+// what a config change has to redo, see CConfigManager::reloadStepsForOption
+enum eConfigReloadStep : uint16_t {
+    RELOAD_NONE        = 0,
+    RELOAD_DECORATIONS = (1 << 0), // window decorations and their animated values
+    RELOAD_LAYOUT      = (1 << 1), // layout switch, recalculating every monitor
+    RELOAD_INPUT       = (1 << 2), // keyboard, pointer, touch and tablet configs
+    RELOAD_SHADER      = (1 << 3), // screen shader and background
+    RELOAD_MONITORS    = (1 << 4), // monitor rules and VRR
+    RELOAD_GROUPBAR    = (1 << 5), // groupbar gradients
+    RELOAD_RULES       = (1 << 6), // dynamic window rules on every workspace
+    RELOAD_REPAINT     = (1 << 7), // blur and a full repaint of every monitor
+    RELOAD_ALL         = 0xFFFF,
+};
+
 struct SWorkspaceRule {
     std::string                        monitor         = "";
     std::string                        workspaceString = "";
+    CWorkspaceSelector                 workspaceSelector; // compiled workspaceString
     std::string                        workspaceName   = "";
     WORKSPACEID                        workspaceId     = -1;
     bool                               isDefault       = false;
@@ -213,6 +228,13 @@ class CConfigManager {
     bool                                               shouldUseSoftwareCursors(PHLMONITOR pMonitor);
     void                                               updateWatcher();
 
+    // deferred and coalesced, everything queued before the event loop goes idle runs in one pass
+    void                                               scheduleReload();
+    void                                               queueReloadSteps(uint16_t steps);
+    // runs what's queued right away, for callers that need to see the result
+    void                                               flushPendingReload();
+    uint16_t                                           reloadStepsForOption(const std::string& name);
+
     std::string                                        parseKeyword(const std::string&, const std::string&);
 
     void                                               addParseError(const std::string&);
@@ -289,6 +311,17 @@ class CConfigManager {
     std::string                                      m_configErrors = "";
 
     uint32_t                                         m_configValueNumber = 0;
+    std::vector<std::string>                         m_configValueNames;
+
+    // keyword lines as they were parsed, to tell whether a reload changed any rules
+    std::string                                      m_monitorRuleInputs;
+    std::string                                      m_ruleInputs; // window, layer and workspace rules
+
+    bool                                             m_reloadScheduled    = false;
+    bool                                             m_reloadFlushQueued  = false;
+    uint16_t                                         m_pendingReloadSteps = RELOAD_NONE;
+
+    std::unordered_map<std::string, std::string>     snapshotConfigValues();
 
     // internal methods
     void                                      updateBlurredLS(const std::string&, const bool);
@@ -296,7 +329,9 @@ class CConfigManager {
     std::optional<std::string>                resetHLConfig();
     std::optional<std::string>                generateConfig(std::string configPath);
     std::optional<std::string>                verifyConfigExists();
-    void                                      postConfigReload(const Hyprlang::CParseResult& result);
+    void                                      postConfigReload(const Hyprlang::CParseResult& result, uint16_t steps);
+    void                                      applyReloadSteps(uint16_t steps);
+    void                                      queueReloadFlush();
     SWorkspaceRule                            mergeWorkspaceRules(const SWorkspaceRule&, const SWorkspaceRule&);
 
     void                                      registerConfigVar(const char* name, const Hyprlang::INT& val);
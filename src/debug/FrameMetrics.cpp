@@ -0,0 +1,321 @@
+#include "FrameMetrics.hpp"
+#include "../helpers/Monitor.hpp"
+#include "../helpers/MiscFunctions.hpp"
+#include <algorithm>
+#include <cmath>
+#include <format>
+
+#define chr std::chrono
+
+size_t CLatencyHistogram::bucketFor(uint64_t us) {
+    us = std::min(us, (1ULL << MAX_VALUE_BITS) - 1);
+
+    if (us < SUB_BUCKETS)
+        return us;
+
+    const uint64_t MSB   = std::bit_width(us) - 1;
+    const uint64_t SHIFT = MSB - (SUB_BUCKET_BITS - 1);
+    return SHIFT * HALF_BUCKETS + (us >> SHIFT);
+}
+
+uint64_t CLatencyHistogram::bucketLowerBound(size_t idx) {
+    if (idx < SUB_BUCKETS)
+        return idx;
+
+    return (idx % HALF_BUCKETS + HALF_BUCKETS) << (idx / HALF_BUCKETS - 1);
+}
+
+void CLatencyHistogram::record(uint64_t us) {
+    m_counts[bucketFor(us)]++;
+    m_count++;
+    m_sum += us;
+    m_min = std::min(m_min, us);
+    m_max = std::max(m_max, us);
+}
+
+void CLatencyHistogram::reset() {
+    m_counts.fill(0);
+    m_count = 0;
+    m_sum   = 0;
+    m_min   = UINT64_MAX;
+    m_max   = 0;
+}
+
+uint64_t CLatencyHistogram::count() const {
+    return m_count;
+}
+
+uint64_t CLatencyHistogram::sum() const {
+    return m_sum;
+}
+
+uint64_t CLatencyHistogram::min() const {
+    return m_count == 0 ? 0 : m_min;
+}
+
+uint64_t CLatencyHistogram::max() const {
+    return m_max;
+}
+
+uint64_t CLatencyHistogram::percentile(double p) const {
+    if (m_count == 0)
+        return 0;
+
+    const uint64_t TARGET = std::max<uint64_t>(1, std::ceil(std::clamp(p, 0.0, 1.0) * m_count));
+    uint64_t       seen   = 0;
+
+    for (size_t i = 0; i < BUCKETS; ++i) {
+        seen += m_counts[i];
+
+        if (seen < TARGET)
+            continue;
+
+        // report the middle of the bucket, but never outside of what we actually saw
+        const uint64_t LOWER = bucketLowerBound(i);
+        const uint64_t UPPER = i + 1 < BUCKETS ? bucketLowerBound(i + 1) : LOWER + 1;
+        return std::clamp((LOWER + UPPER - 1) / 2, m_min, m_max);
+    }
+
+    return m_max;
+}
+
+static uint64_t usBetween(const Time::steady_tp& from, const Time::steady_tp& to) {
+    if (to <= from)
+        return 0;
+    return chr::duration_cast<chr::microseconds>(to - from).count();
+}
+
+void CFrameMetrics::onMonitorRemoved(PHLMONITOR pMonitor) {
+    m_monitors.erase(pMonitor->m_id);
+}
+
+CFrameMetrics::SMonitorMetrics& CFrameMetrics::metricsFor(PHLMONITOR pMonitor) {
+    auto& m = m_monitors[pMonitor->m_id];
+    if (m.name != pMonitor->m_name)
+        m.name = pMonitor->m_name;
+    return m;
+}
+
+void CFrameMetrics::onRender(PHLMONITOR pMonitor, float durationUs) {
+    metricsFor(pMonitor).renderTime.record((uint64_t)durationUs);
+}
+
+void CFrameMetrics::onCommit(PHLMONITOR pMonitor) {
+    auto&      m   = metricsFor(pMonitor);
+    const auto NOW = Time::steadyNow();
+
+    m.lastCommit    = NOW;
+    m.commitPending = true;
+
+    // the oldest input not yet shown on this monitor is what this commit answers to
+    if (m_hasInput && m_lastInput > m.lastInputSeen) {
+        if (!m.inputPending) {
+            m.pendingInput = m_lastInput;
+            m.inputPending = true;
+        }
+        m.lastInputSeen = m_lastInput;
+    }
+}
+
+void CFrameMetrics::onPresent(PHLMONITOR pMonitor, const Time::steady_tp& when) {
+    auto& m = metricsFor(pMonitor);
+
+    if (m.presentedOnce)
+        m.frameInterval.record(usBetween(m.lastPresent, when));
+
+    if (m.commitPending)
+        m.commitToPresent.record(usBetween(m.lastCommit, when));
+
+    if (m.inputPending)
+        m.inputToPresent.record(usBetween(m.pendingInput, when));
+
+    m.lastPresent   = when;
+    m.presentedOnce = true;
+    m.commitPending = false;
+    m.inputPending  = false;
+}
+
+void CFrameMetrics::onInput() {
+    m_lastInput = Time::steadyNow();
+    m_hasInput  = true;
+}
+
+void CFrameMetrics::onRepaint(PHLMONITOR pMonitor, const CRegion& damage) {
+    uint64_t pixels = 0;
+    for (auto const& r : damage.getRects()) {
+        pixels += (uint64_t)(r.x2 - r.x1) * (r.y2 - r.y1);
+    }
+
+    metricsFor(pMonitor).repaintedPixels.record(pixels);
+}
+
+void CFrameMetrics::onOcclusion(PHLMONITOR pMonitor, size_t windows, size_t elements) {
+    auto& m = metricsFor(pMonitor);
+    m.occludedWindows.record(windows);
+    m.occludedElements.record(elements);
+}
+
+void CFrameMetrics::onPass(PHLMONITOR pMonitor, size_t elements, size_t allocations) {
+    auto& m = metricsFor(pMonitor);
+    m.passElements.record(elements);
+    m.passAllocations.record(allocations);
+}
+
+void CFrameMetrics::onScheduled(PHLMONITOR pMonitor, uint64_t delayUs) {
+    metricsFor(pMonitor).scheduleDelay.record(delayUs);
+}
+
+void CFrameMetrics::onDMABUFFeedback(bool sent) {
+    if (sent)
+        m_dmabufFeedbackSent++;
+    else
+        m_dmabufFeedbackSuppressed++;
+}
+
+void CFrameMetrics::reset() {
+    m_dmabufFeedbackSent       = 0;
+    m_dmabufFeedbackSuppressed = 0;
+
+    for (auto& [id, m] : m_monitors) {
+        m.renderTime.reset();
+        m.frameInterval.reset();
+        m.commitToPresent.reset();
+        m.inputToPresent.reset();
+        m.repaintedPixels.reset();
+        m.occludedWindows.reset();
+        m.occludedElements.reset();
+        m.passElements.reset();
+        m.passAllocations.reset();
+        m.scheduleDelay.reset();
+    }
+}
+
+struct SMetricDescription {
+    const char*                                        name;
+    const char*                                        help;
+    CLatencyHistogram CFrameMetrics::SMonitorMetrics::*histogram;
+    bool                                               time = true; // microseconds if true, a plain count otherwise
+};
+
+static const std::array<SMetricDescription, 10> METRICS = {
+    SMetricDescription{"render_time", "Time spent in renderMonitor for a rendered frame", &CFrameMetrics::SMonitorMetrics::renderTime},
+    SMetricDescription{"frame_interval", "Time between consecutive presentations", &CFrameMetrics::SMonitorMetrics::frameInterval},
+    SMetricDescription{"commit_to_present", "Time from an output commit to its presentation", &CFrameMetrics::SMonitorMetrics::commitToPresent},
+    SMetricDescription{"input_to_present", "Time from an input event to the first presentation after it", &CFrameMetrics::SMonitorMetrics::inputToPresent},
+    SMetricDescription{"repainted_pixels", "Pixels repainted per rendered frame", &CFrameMetrics::SMonitorMetrics::repaintedPixels, false},
+    SMetricDescription{"occluded_windows", "Windows skipped per rendered frame by occlusion culling", &CFrameMetrics::SMonitorMetrics::occludedWindows, false},
+    SMetricDescription{"occluded_elements", "Pass elements not built per rendered frame due to occlusion culling", &CFrameMetrics::SMonitorMetrics::occludedElements, false},
+    SMetricDescription{"pass_elements", "Render pass elements per rendered frame", &CFrameMetrics::SMonitorMetrics::passElements, false},
+    SMetricDescription{"pass_allocations", "Heap allocations made building the render pass of a frame", &CFrameMetrics::SMonitorMetrics::passAllocations, false},
+    SMetricDescription{"schedule_delay", "How much fresher a predictively scheduled frame was, i.e. time from the frame event to its deferred render",
+                       &CFrameMetrics::SMonitorMetrics::scheduleDelay},
+};
+
+static const std::array<double, 5> QUANTILES = {0.5, 0.9, 0.95, 0.99, 0.999};
+
+// label values in the exposition format need \\, \" and \n escaped
+static std::string escapePrometheusLabel(const std::string& str) {
+    std::string result;
+    result.reserve(str.size());
+
+    for (const char c : str) {
+        switch (c) {
+            case '\\': result += "\\\\"; break;
+            case '"': result += "\\\""; break;
+            case '\n': result += "\\n"; break;
+            default: result += c; break;
+        }
+    }
+
+    return result;
+}
+
+std::string CFrameMetrics::dump(eMetricsFormat format) {
+    std::string result;
+
+    if (format == METRICS_FORMAT_PROMETHEUS) {
+        for (auto const& desc : METRICS) {
+            const std::string NAME  = std::format("hyprland_{}{}", desc.name, desc.time ? "_seconds" : "");
+            const double      SCALE = desc.time ? 1000000.0 : 1.0;
+
+            result += std::format("# HELP {} {}\n# TYPE {} summary\n", NAME, desc.help, NAME);
+
+            for (auto const& [id, m] : m_monitors) {
+                const auto& H     = m.*desc.histogram;
+                const auto  LABEL = escapePrometheusLabel(m.name);
+                for (const auto Q : QUANTILES) {
+                    result += std::format("{}{{monitor=\"{}\",quantile=\"{}\"}} {:.6f}\n", NAME, LABEL, Q, H.percentile(Q) / SCALE);
+                }
+                result += std::format("{}_sum{{monitor=\"{}\"}} {:.6f}\n", NAME, LABEL, H.sum() / SCALE);
+                result += std::format("{}_count{{monitor=\"{}\"}} {}\n", NAME, LABEL, H.count());
+            }
+        }
+
+        result += std::format("# HELP hyprland_dmabuf_feedback_sent_total DMABUF feedback batches sent to clients\n# TYPE hyprland_dmabuf_feedback_sent_total counter\n"
+                              "hyprland_dmabuf_feedback_sent_total {}\n",
+                              m_dmabufFeedbackSent);
+        result += std::format("# HELP hyprland_dmabuf_feedback_suppressed_total DMABUF feedback batches not sent because they were unchanged or debounced, "
+                              "each a buffer reallocation clients didn't do\n# TYPE hyprland_dmabuf_feedback_suppressed_total counter\n"
+                              "hyprland_dmabuf_feedback_suppressed_total {}\n",
+                              m_dmabufFeedbackSuppressed);
+
+        return result;
+    }
+
+    if (format == METRICS_FORMAT_JSON) {
+        result += "[";
+        for (auto const& [id, m] : m_monitors) {
+            result += std::format(R"#({{
+    "id": {},
+    "monitor": "{}",)#",
+                                  id, escapeJSONStrings(m.name));
+
+            for (auto const& desc : METRICS) {
+                const auto& H    = m.*desc.histogram;
+                const auto  UNIT = desc.time ? "Us" : "";
+                result += std::format(R"#(
+    "{}": {{
+        "count": {},
+        "sum{}": {},
+        "min{}": {},
+        "max{}": {},
+        "p50{}": {},
+        "p90{}": {},
+        "p95{}": {},
+        "p99{}": {},
+        "p999{}": {}
+    }},)#",
+                                      desc.name, H.count(), UNIT, H.sum(), UNIT, H.min(), UNIT, H.max(), UNIT, H.percentile(0.5), UNIT, H.percentile(0.9), UNIT,
+                                      H.percentile(0.95), UNIT, H.percentile(0.99), UNIT, H.percentile(0.999));
+            }
+
+            result.pop_back();
+            result += "\n},";
+        }
+
+        if (result.back() == ',')
+            result.pop_back();
+        result += "]";
+        return result;
+    }
+
+    for (auto const& [id, m] : m_monitors) {
+        result += std::format("Monitor {} (ID {}):\n", m.name, id);
+        for (auto const& desc : METRICS) {
+            const auto& H = m.*desc.histogram;
+            if (!desc.time) {
+                result += std::format("\t{}: count {}, min {}, p50 {}, p90 {}, p99 {}, p99.9 {}, max {}\n", desc.name, H.count(), H.min(), H.percentile(0.5),
+                                      H.percentile(0.9), H.percentile(0.99), H.percentile(0.999), H.max());
+                continue;
+            }
+
+            result += std::format("\t{}: count {}, min {:.2f}ms, p50 {:.2f}ms, p90 {:.2f}ms, p99 {:.2f}ms, p99.9 {:.2f}ms, max {:.2f}ms\n", desc.name, H.count(), H.min() / 1000.0,
+                                  H.percentile(0.5) / 1000.0, H.percentile(0.9) / 1000.0, H.percentile(0.99) / 1000.0, H.percentile(0.999) / 1000.0, H.max() / 1000.0);
+        }
+        result += "\n";
+    }
+
+    result += std::format("DMABUF feedback: sent {}, suppressed {} (unchanged or debounced)\n", m_dmabufFeedbackSent, m_dmabufFeedbackSuppressed);
+
+    return result;
+}
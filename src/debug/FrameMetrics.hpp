@@ -0,0 +1,100 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <map>
+#include <string>
+#include "../helpers/time/Time.hpp"
+#include "../desktop/DesktopTypes.hpp"
+#include "../SharedDefs.hpp"
+#include "../helpers/math/Math.hpp"
+
+/*
+    Log-linear (HDR-style) histogram, mostly used over microseconds.
+    Each power of two is split into SUB_BUCKETS / 2 linear buckets, which keeps
+    the relative error of any reported percentile under ~3% across the whole range.
+    Recording is a couple of bit ops and an increment.
+*/
+class CLatencyHistogram {
+  public:
+    void                      record(uint64_t us);
+    void                      reset();
+
+    uint64_t                  count() const;
+    uint64_t                  sum() const;
+    uint64_t                  min() const;
+    uint64_t                  max() const;
+    // p in [0, 1]
+    uint64_t                  percentile(double p) const;
+
+    static constexpr uint64_t SUB_BUCKET_BITS = 5;
+    static constexpr uint64_t SUB_BUCKETS     = 1 << SUB_BUCKET_BITS;
+    static constexpr uint64_t HALF_BUCKETS    = SUB_BUCKETS / 2;
+    static constexpr uint64_t MAX_VALUE_BITS  = 30; // ~17 minutes or a 32k x 32k output, anything above is clamped
+    static constexpr uint64_t BUCKETS         = (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * HALF_BUCKETS + HALF_BUCKETS;
+
+  private:
+    static size_t                 bucketFor(uint64_t us);
+    static uint64_t               bucketLowerBound(size_t idx);
+
+    std::array<uint64_t, BUCKETS> m_counts = {};
+    uint64_t                      m_count  = 0;
+    uint64_t                      m_sum    = 0;
+    uint64_t                      m_min    = UINT64_MAX;
+    uint64_t                      m_max    = 0;
+};
+
+enum eMetricsFormat : uint8_t {
+    METRICS_FORMAT_TEXT = 0,
+    METRICS_FORMAT_JSON,
+    METRICS_FORMAT_PROMETHEUS,
+};
+
+class CFrameMetrics {
+  public:
+    void        onRender(PHLMONITOR pMonitor, float durationUs);
+    void        onCommit(PHLMONITOR pMonitor);
+    void        onPresent(PHLMONITOR pMonitor, const Time::steady_tp& when);
+    void        onInput();
+    void        onRepaint(PHLMONITOR pMonitor, const CRegion& damage);
+    void        onOcclusion(PHLMONITOR pMonitor, size_t windows, size_t elements);
+    void        onPass(PHLMONITOR pMonitor, size_t elements, size_t allocations);
+    // how much later than the frame event a predictively scheduled frame was rendered
+    void        onScheduled(PHLMONITOR pMonitor, uint64_t delayUs);
+    // sent = false when an unchanged or debounced feedback was suppressed
+    void        onDMABUFFeedback(bool sent);
+    void        onMonitorRemoved(PHLMONITOR pMonitor);
+
+    void        reset();
+    std::string dump(eMetricsFormat format);
+
+    struct SMonitorMetrics {
+        std::string       name;
+        CLatencyHistogram renderTime, frameInterval, commitToPresent, inputToPresent;
+        CLatencyHistogram repaintedPixels; // per rendered frame, after damage simplification
+        CLatencyHistogram occludedWindows, occludedElements;
+        CLatencyHistogram passElements, passAllocations;
+        CLatencyHistogram scheduleDelay;
+
+        Time::steady_tp   lastPresent;
+        Time::steady_tp   lastCommit;
+        Time::steady_tp   pendingInput;
+        Time::steady_tp   lastInputSeen;
+        bool              commitPending = false;
+        bool              inputPending  = false;
+        bool              presentedOnce = false;
+    };
+
+  private:
+    SMonitorMetrics&                     metricsFor(PHLMONITOR pMonitor);
+
+    std::map<MONITORID, SMonitorMetrics> m_monitors;
+    Time::steady_tp                      m_lastInput;
+    bool                                 m_hasInput = false;
+
+    uint64_t                             m_dmabufFeedbackSent       = 0;
+    uint64_t                             m_dmabufFeedbackSuppressed = 0;
+};
+
+inline UP<CFrameMetrics> g_pFrameMetrics;
@@ -0,0 +1,188 @@
+#include "FrameTracer.hpp"
+#include "Log.hpp"
+#include <algorithm>
+#include <format>
+#include <fstream>
+#include <unistd.h>
+
+static std::atomic<uint64_t> nextTracerID = 1;
+
+CFrameTracer::CFrameTracer() {
+    m_instanceID = nextTracerID++;
+    m_mainThread = std::this_thread::get_id();
+}
+
+bool CFrameTracer::start() {
+    if (m_active)
+        return false;
+
+    {
+        std::lock_guard<std::mutex> lg(m_ringsMutex);
+        for (auto const& r : m_rings) {
+            std::lock_guard<std::mutex> rlg(r->mutex);
+            r->written = 0;
+        }
+    }
+
+    m_startedAt = Time::steadyNow();
+    m_active.store(true, std::memory_order_release);
+
+    Debug::log(LOG, "FrameTracer: started recording");
+    return true;
+}
+
+bool CFrameTracer::active() const {
+    return m_active.load(std::memory_order_relaxed);
+}
+
+size_t CFrameTracer::recordedEvents() {
+    std::lock_guard<std::mutex> lg(m_ringsMutex);
+    size_t                      total = 0;
+    for (auto const& r : m_rings) {
+        std::lock_guard<std::mutex> rlg(r->mutex);
+        total += std::min(r->written, RING_CAPACITY);
+    }
+    return total;
+}
+
+CFrameTracer::SThreadRing* CFrameTracer::ringForThisThread() {
+    // cache the ring per thread, keyed by the tracer instance so a recreated tracer doesn't see stale rings
+    static thread_local uint64_t     cachedOwner = 0;
+    static thread_local SThreadRing* cachedRing  = nullptr;
+
+    if (cachedOwner == m_instanceID && cachedRing)
+        return cachedRing;
+
+    std::lock_guard<std::mutex> lg(m_ringsMutex);
+    auto&                       ring = m_rings.emplace_back(makeUnique<SThreadRing>());
+    ring->tid                        = m_rings.size();
+    ring->main                       = std::this_thread::get_id() == m_mainThread;
+
+    cachedOwner = m_instanceID;
+    cachedRing  = ring.get();
+    return cachedRing;
+}
+
+void CFrameTracer::push(const SEvent& ev) {
+    auto* const                 ring = ringForThisThread();
+
+    std::lock_guard<std::mutex> lg(ring->mutex);
+    ring->events[ring->written % RING_CAPACITY] = ev;
+    ring->written++;
+}
+
+static uint64_t nsSince(const Time::steady_tp& from, const Time::steady_tp& to) {
+    if (to <= from)
+        return 0;
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count();
+}
+
+void CFrameTracer::span(const char* name, eTraceCategory category, const Time::steady_tp& begin, const Time::steady_tp& end, const char* argName, int64_t arg) {
+    if (!active())
+        return;
+
+    push(SEvent{
+        .name     = name,
+        .argName  = argName,
+        .arg      = arg,
+        .beginNs  = nsSince(m_startedAt, begin),
+        .durNs    = nsSince(begin, end),
+        .category = category,
+        .instant  = false,
+    });
+}
+
+void CFrameTracer::instant(const char* name, eTraceCategory category, const char* argName, int64_t arg) {
+    if (!active())
+        return;
+
+    push(SEvent{
+        .name     = name,
+        .argName  = argName,
+        .arg      = arg,
+        .beginNs  = nsSince(m_startedAt, Time::steadyNow()),
+        .durNs    = 0,
+        .category = category,
+        .instant  = true,
+    });
+}
+
+static const char* categoryName(eTraceCategory category) {
+    switch (category) {
+        case TRACE_CATEGORY_RENDER: return "render";
+        case TRACE_CATEGORY_PASS: return "pass";
+        case TRACE_CATEGORY_OUTPUT: return "output";
+        case TRACE_CATEGORY_INPUT: return "input";
+        case TRACE_CATEGORY_IPC: return "ipc";
+    }
+    return "unknown";
+}
+
+std::string CFrameTracer::stop(const std::string& path) {
+    if (!m_active)
+        return "tracer is not running";
+
+    m_active.store(false, std::memory_order_release);
+
+    std::ofstream ofs(path, std::ios::trunc);
+    if (!ofs.good())
+        return std::format("couldn't open {} for writing", path);
+
+    const auto PID = getpid();
+
+    ofs << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+    ofs << std::format(R"({{"name": "process_name", "ph": "M", "pid": {}, "tid": 0, "args": {{"name": "Hyprland"}}}})", PID);
+
+    size_t                      total = 0;
+
+    std::lock_guard<std::mutex> lg(m_ringsMutex);
+    for (auto const& r : m_rings) {
+        std::lock_guard<std::mutex> rlg(r->mutex);
+
+        ofs << std::format(",\n" R"({{"name": "thread_name", "ph": "M", "pid": {}, "tid": {}, "args": {{"name": "{}"}}}})", PID, r->tid,
+                           r->main ? "main" : std::format("thread {}", r->tid));
+
+        const size_t COUNT = std::min(r->written, RING_CAPACITY);
+        const size_t FIRST = r->written - COUNT;
+
+        for (size_t i = FIRST; i < r->written; ++i) {
+            const auto& ev = r->events[i % RING_CAPACITY];
+
+            ofs << std::format(",\n" R"({{"name": "{}", "cat": "{}", "pid": {}, "tid": {}, "ts": {:.3f})", ev.name, categoryName(ev.category), PID, r->tid,
+                               ev.beginNs / 1000.0);
+
+            if (ev.instant)
+                ofs << R"(, "ph": "i", "s": "t")";
+            else
+                ofs << std::format(R"(, "ph": "X", "dur": {:.3f})", ev.durNs / 1000.0);
+
+            if (ev.argName)
+                ofs << std::format(R"(, "args": {{"{}": {}}})", ev.argName, ev.arg);
+
+            ofs << "}";
+        }
+
+        total += COUNT;
+        r->written = 0;
+    }
+
+    ofs << "\n]}\n";
+    ofs.close();
+
+    Debug::log(LOG, "FrameTracer: wrote {} events to {}", total, path);
+
+    return "";
+}
+
+CScopedTrace::CScopedTrace(const char* name, eTraceCategory category, const char* argName, int64_t arg) :
+    m_name(name), m_argName(argName), m_arg(arg), m_category(category), m_recording(g_pFrameTracer && g_pFrameTracer->active()) {
+    if (m_recording)
+        m_begin = Time::steadyNow();
+}
+
+CScopedTrace::~CScopedTrace() {
+    if (!m_recording || !g_pFrameTracer)
+        return;
+
+    g_pFrameTracer->span(m_name, m_category, m_begin, Time::steadyNow(), m_argName, m_arg);
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../helpers/memory/Memory.hpp"
+#include "../helpers/time/Time.hpp"
+
+enum eTraceCategory : uint8_t {
+    TRACE_CATEGORY_RENDER = 0,
+    TRACE_CATEGORY_PASS,
+    TRACE_CATEGORY_OUTPUT,
+    TRACE_CATEGORY_INPUT,
+    TRACE_CATEGORY_IPC,
+};
+
+/*
+    Built-in tracer for the render loop, input and IPC.
+    While inactive, a trace point costs one relaxed atomic load.
+    While active, events go into a fixed-size ring owned by the recording thread, and are
+    serialized as Chrome trace-event JSON (loadable in chrome://tracing or Perfetto) on stop().
+
+    Event and arg names are not copied, they have to be string literals.
+*/
+class CFrameTracer {
+  public:
+    CFrameTracer();
+
+    bool        start();
+    std::string stop(const std::string& path); // empty on success, error otherwise
+    bool        active() const;
+    size_t      recordedEvents();
+
+    void        span(const char* name, eTraceCategory category, const Time::steady_tp& begin, const Time::steady_tp& end, const char* argName = nullptr, int64_t arg = 0);
+    void        instant(const char* name, eTraceCategory category, const char* argName = nullptr, int64_t arg = 0);
+
+    // per-thread ring capacity. When full, the oldest events are overwritten.
+    static constexpr size_t RING_CAPACITY = 32768;
+
+  private:
+    struct SEvent {
+        const char*    name     = nullptr;
+        const char*    argName  = nullptr;
+        int64_t        arg      = 0;
+        uint64_t       beginNs  = 0;
+        uint64_t       durNs    = 0;
+        eTraceCategory category = TRACE_CATEGORY_RENDER;
+        bool           instant  = false;
+    };
+
+    struct SThreadRing {
+        std::mutex                        mutex;
+        std::array<SEvent, RING_CAPACITY> events;
+        size_t                            written = 0;
+        uint64_t                          tid     = 0;
+        bool                              main    = false;
+    };
+
+    SThreadRing*                 ringForThisThread();
+    void                         push(const SEvent& ev);
+
+    std::atomic<bool>            m_active = false;
+    Time::steady_tp              m_startedAt;
+    uint64_t                     m_instanceID = 0;
+    std::thread::id              m_mainThread;
+
+    std::mutex                   m_ringsMutex;
+    std::vector<UP<SThreadRing>> m_rings;
+};
+
+inline UP<CFrameTracer> g_pFrameTracer;
+
+// RAII span, recorded when it goes out of scope. Does nothing if tracing was off when it was created.
+class CScopedTrace {
+  public:
+    CScopedTrace(const char* name, eTraceCategory category, const char* argName = nullptr, int64_t arg = 0);
+    ~CScopedTrace();
+
+    CScopedTrace(const CScopedTrace&)            = delete;
+    CScopedTrace& operator=(const CScopedTrace&) = delete;
+
+  private:
+    const char*     m_name    = nullptr;
+    const char*     m_argName = nullptr;
+    int64_t         m_arg     = 0;
+    eTraceCategory  m_category;
+    bool            m_recording = false;
+    Time::steady_tp m_begin;
+};
+
+#define TRACE_CONCAT_INNER(a, b)         a##b
+#define TRACE_CONCAT(a, b)               TRACE_CONCAT_INNER(a, b)
+#define TRACE_SCOPE(name, category, ...) CScopedTrace TRACE_CONCAT(scopedTrace_, __LINE__)(name, category, ##__VA_ARGS__)
@@ -52,6 +52,9 @@ using namespace Hyprutils::OS;
 #include "../plugins/PluginSystem.hpp"
 #include "../managers/AnimationManager.hpp"
 #include "../debug/HyprNotificationOverlay.hpp"
+#include "../debug/FrameTracer.hpp"
+#include "../debug/FrameMetrics.hpp"
+#include "../helpers/StartupTasks.hpp"
 #include "../render/Renderer.hpp"
 #include "../render/OpenGL.hpp"
 
@@ -288,8 +291,8 @@ std::string CHyprCtl::getWindowData(PHLWINDOW w, eHyprCtlOutputFormat format) {
     "xdgDescription": "{}"
 }},)#",
             (uintptr_t)w.get(), (w->m_isMapped ? "true" : "false"), (w->isHidden() ? "true" : "false"), (int)w->m_realPosition->goal().x, (int)w->m_realPosition->goal().y,
-            (int)w->m_realSize->goal().x, (int)w->m_realSize->goal().y, w->m_workspace ? w->workspaceID() : WORKSPACE_INVALID,
-            escapeJSONStrings(!w->m_workspace ? "" : w->m_workspace->m_name), ((int)w->m_isFloating == 1 ? "true" : "false"), (w->m_isPseudotiled ? "true" : "false"),
+            (int)w->m_realSize->goal().x, (int)w->m_realSize->goal().y, w->workspace() ? w->workspaceID() : WORKSPACE_INVALID,
+            escapeJSONStrings(!w->workspace() ? "" : w->workspace()->m_name), ((int)w->m_isFloating == 1 ? "true" : "false"), (w->m_isPseudotiled ? "true" : "false"),
             (int64_t)w->monitorID(), escapeJSONStrings(w->m_class), escapeJSONStrings(w->m_title), escapeJSONStrings(w->m_initialClass), escapeJSONStrings(w->m_initialTitle),
             w->getPID(), ((int)w->m_isX11 == 1 ? "true" : "false"), (w->m_pinned ? "true" : "false"), (uint8_t)w->m_fullscreenState.internal, (uint8_t)w->m_fullscreenState.client,
             getGroupedData(w, format), getTagsData(w, format), (uintptr_t)w->m_swallowed.get(), getFocusHistoryID(w),
@@ -302,7 +305,7 @@ std::string CHyprCtl::getWindowData(PHLWINDOW w, eHyprCtlOutputFormat format) {
             "{}\n\tfullscreen: {}\n\tfullscreenClient: {}\n\tgrouped: {}\n\ttags: {}\n\tswallowing: {:x}\n\tfocusHistoryID: {}\n\tinhibitingIdle: {}\n\txdgTag: "
             "{}\n\txdgDescription: {}\n\n",
             (uintptr_t)w.get(), w->m_title, (int)w->m_isMapped, (int)w->isHidden(), (int)w->m_realPosition->goal().x, (int)w->m_realPosition->goal().y,
-            (int)w->m_realSize->goal().x, (int)w->m_realSize->goal().y, w->m_workspace ? w->workspaceID() : WORKSPACE_INVALID, (!w->m_workspace ? "" : w->m_workspace->m_name),
+            (int)w->m_realSize->goal().x, (int)w->m_realSize->goal().y, w->workspace() ? w->workspaceID() : WORKSPACE_INVALID, (!w->workspace() ? "" : w->workspace()->m_name),
             (int)w->m_isFloating, (int)w->m_isPseudotiled, (int64_t)w->monitorID(), w->m_class, w->m_title, w->m_initialClass, w->m_initialTitle, w->getPID(), (int)w->m_isX11,
             (int)w->m_pinned, (uint8_t)w->m_fullscreenState.internal, (uint8_t)w->m_fullscreenState.client, getGroupedData(w, format), getTagsData(w, format),
             (uintptr_t)w->m_swallowed.get(), getFocusHistoryID(w), (int)g_pInputManager->isWindowInhibiting(w, false), w->xdgTag().value_or(""), w->xdgDescription().value_or(""));
@@ -1115,38 +1118,11 @@ static std::string dispatchKeyword(eHyprCtlOutputFormat format, std::string in)
     if (COMMAND == "monitor" || COMMAND == "source")
         g_pConfigManager->m_wantsMonitorReload = true; // for monitor keywords
 
-    if (COMMAND.contains("input") || COMMAND.contains("device") || COMMAND == "source") {
-        g_pInputManager->setKeyboardLayout();     // update kb layout
-        g_pInputManager->setPointerConfigs();     // update mouse cfgs
-        g_pInputManager->setTouchDeviceConfigs(); // update touch device cfgs
-        g_pInputManager->setTabletConfigs();      // update tablets
-    }
-
-    static auto PLAYOUT = CConfigValue<std::string>("general:layout");
-
-    if (COMMAND.contains("general:layout"))
-        g_pLayoutManager->switchToLayout(*PLAYOUT); // update layout
-
-    if (COMMAND.contains("decoration:screen_shader") || COMMAND == "source")
-        g_pHyprOpenGL->m_bReloadScreenShader = true;
-
-    if (COMMAND.contains("blur") || COMMAND == "source") {
-        for (auto& [m, rd] : g_pHyprOpenGL->m_mMonitorRenderResources) {
-            rd.blurFBDirty = true;
-        }
-    }
-
     if (COMMAND.contains("misc:disable_autoreload"))
         g_pConfigManager->updateWatcher();
 
-    // decorations will probably need a repaint
-    if (COMMAND.contains("decoration:") || COMMAND.contains("border") || COMMAND == "workspace" || COMMAND.contains("zoom_factor") || COMMAND == "source" ||
-        COMMAND.starts_with("windowrule")) {
-        for (auto const& m : g_pCompositor->m_monitors) {
-            g_pHyprRenderer->damageMonitor(m);
-            g_pLayoutManager->getCurrentLayout()->recalculateMonitor(m->m_id);
-        }
-    }
+    // only what this option feeds, e.g. a border color doesn't relayout. Queued, a batch of keywords pays for it once
+    g_pConfigManager->queueReloadSteps(g_pConfigManager->reloadStepsForOption(COMMAND));
 
     Debug::log(LOG, "Hyprctl: keyword {} : {}", COMMAND, VALUE);
 
@@ -1687,6 +1663,63 @@ static std::string reloadShaders(eHyprCtlOutputFormat format, std::string reques
         return format == FORMAT_JSON ? "{\"ok\": false}" : "error";
 }
 
+static std::string dispatchTrace(eHyprCtlOutputFormat format, std::string request) {
+    CVarList vars(request, 0, ' ');
+
+    if (vars.size() < 2)
+        return "not enough args";
+
+    const auto MODE = vars[1];
+
+    if (MODE == "start") {
+        if (!g_pFrameTracer->start())
+            return "tracer is already running";
+    } else if (MODE == "stop") {
+        const auto PATH = vars[2].empty() ? g_pCompositor->m_instancePath + "/trace.json" : vars[2];
+
+        if (!PATH.starts_with("/"))
+            return "trace path has to be absolute";
+
+        if (const auto ERR = g_pFrameTracer->stop(PATH); !ERR.empty())
+            return ERR;
+
+        return format == FORMAT_JSON ? std::format(R"({{"ok": true, "path": "{}"}})", escapeJSONStrings(PATH)) : std::format("ok, trace written to {}", PATH);
+    } else if (MODE == "status") {
+        const bool   ACTIVE = g_pFrameTracer->active();
+        const size_t EVENTS = g_pFrameTracer->recordedEvents();
+        return format == FORMAT_JSON ? std::format(R"({{"active": {}, "events": {}}})", ACTIVE, EVENTS) :
+                                       std::format("tracing: {}\nrecorded events: {}\n", ACTIVE ? "on" : "off", EVENTS);
+    } else
+        return "unknown trace mode, expected start, stop or status";
+
+    return format == FORMAT_JSON ? "{\"ok\": true}" : "ok";
+}
+
+static std::string metricsRequest(eHyprCtlOutputFormat format, std::string request) {
+    CVarList vars(request, 0, ' ');
+
+    if (vars[1] == "reset") {
+        g_pFrameMetrics->reset();
+        return format == FORMAT_JSON ? "{\"ok\": true}" : "ok";
+    }
+
+    if (vars[1] == "prometheus")
+        return g_pFrameMetrics->dump(METRICS_FORMAT_PROMETHEUS);
+
+    if (!vars[1].empty())
+        return "unknown metrics mode, expected reset or prometheus";
+
+    const auto RESULT = g_pFrameMetrics->dump(format == FORMAT_JSON ? METRICS_FORMAT_JSON : METRICS_FORMAT_TEXT);
+    return RESULT.empty() ? "no frames recorded yet" : RESULT;
+}
+
+static std::string startupRequest(eHyprCtlOutputFormat format, std::string request) {
+    if (!g_pStartupTasks)
+        return format == FORMAT_JSON ? "{}" : "startup timeline not available";
+
+    return g_pStartupTasks->dump(format == FORMAT_JSON);
+}
+
 CHyprCtl::CHyprCtl() {
     registerCommand(SHyprCtlCommand{"workspaces", true, workspacesRequest});
     registerCommand(SHyprCtlCommand{"workspacerules", true, workspaceRulesRequest});
@@ -1725,6 +1758,9 @@ CHyprCtl::CHyprCtl() {
     registerCommand(SHyprCtlCommand{"setcursor", false, dispatchSetCursor});
     registerCommand(SHyprCtlCommand{"getoption", false, dispatchGetOption});
     registerCommand(SHyprCtlCommand{"decorations", false, decorationRequest});
+    registerCommand(SHyprCtlCommand{"trace", false, dispatchTrace});
+    registerCommand(SHyprCtlCommand{"metrics", false, metricsRequest});
+    registerCommand(SHyprCtlCommand{"startup", true, startupRequest});
     registerCommand(SHyprCtlCommand{"[[BATCH]]", false, dispatchBatch});
 
     startHyprCtlSocket();
@@ -1784,6 +1820,10 @@ std::string CHyprCtl::getReply(std::string request) {
 
     std::string result = "";
 
+    // anything but more keywords should see what the queued ones changed
+    if (!request.starts_with("keyword") && !request.starts_with("[[BATCH]]"))
+        g_pConfigManager->flushPendingReload();
+
     // parse exact cmds first, then non-exact.
     for (auto const& cmd : m_commands) {
         if (!cmd->exact)
@@ -1812,33 +1852,7 @@ std::string CHyprCtl::getReply(std::string request) {
     if (reloadAll) {
         g_pConfigManager->m_wantsMonitorReload = true; // for monitor keywords
 
-        g_pInputManager->setKeyboardLayout();     // update kb layout
-        g_pInputManager->setPointerConfigs();     // update mouse cfgs
-        g_pInputManager->setTouchDeviceConfigs(); // update touch device cfgs
-        g_pInputManager->setTabletConfigs();      // update tablets
-
-        static auto PLAYOUT = CConfigValue<std::string>("general:layout");
-
-        g_pLayoutManager->switchToLayout(*PLAYOUT); // update layout
-
-        g_pHyprOpenGL->m_bReloadScreenShader = true;
-
-        for (auto& [m, rd] : g_pHyprOpenGL->m_mMonitorRenderResources) {
-            rd.blurFBDirty = true;
-        }
-
-        for (auto const& w : g_pCompositor->m_windows) {
-            if (!w->m_isMapped || !w->m_workspace || !w->m_workspace->isVisible())
-                continue;
-
-            w->updateDynamicRules();
-            g_pCompositor->updateWindowAnimatedDecorationValues(w);
-        }
-
-        for (auto const& m : g_pCompositor->m_monitors) {
-            g_pHyprRenderer->damageMonitor(m);
-            g_pLayoutManager->getCurrentLayout()->recalculateMonitor(m->m_id);
-        }
+        g_pConfigManager->queueReloadSteps(RELOAD_INPUT | RELOAD_LAYOUT | RELOAD_SHADER | RELOAD_RULES | RELOAD_DECORATIONS | RELOAD_REPAINT);
     }
 
     return result;
@@ -1942,6 +1956,7 @@ static int hyprCtlFDTick(int fd, uint32_t mask, void* data) {
     std::string reply = "";
 
     try {
+        TRACE_SCOPE("hyprctl", TRACE_CATEGORY_IPC);
         reply = g_pHyprCtl->getReply(request);
     } catch (std::exception& e) {
         Debug::log(ERR, "Error in request: {}", e.what());
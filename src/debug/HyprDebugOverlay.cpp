@@ -21,6 +21,9 @@ void CHyprMonitorDebugOverlay::renderData(PHLMONITOR pMonitor, float durationUs)
     if (m_lastRenderTimes.size() > (long unsigned int)pMonitor->m_refreshRate)
         m_lastRenderTimes.pop_front();
 
+    m_lastDrawCalls  = g_pHyprOpenGL->m_sDrawStats.drawCalls;
+    m_lastDrawsSaved = g_pHyprOpenGL->m_sDrawStats.drawsSaved;
+
     if (!m_monitor)
         m_monitor = pMonitor;
 }
@@ -192,6 +195,9 @@ int CHyprMonitorDebugOverlay::draw(int offset) {
     text = std::format("Avg Anim Tick: {:.2f}ms (var {:.2f}ms) ({:.2f} TPS)", avgAnimMgrTick, varAnimMgrTick, 1.0 / (avgAnimMgrTick / 1000.0));
     showText(text.c_str(), 10);
 
+    text = std::format("Draw calls: {} ({} without batching)", m_lastDrawCalls, m_lastDrawCalls + m_lastDrawsSaved);
+    showText(text.c_str(), 10);
+
     pango_font_description_free(pangoFD);
     g_object_unref(layoutText);
 
@@ -274,5 +280,5 @@ void CHyprDebugOverlay::draw() {
     CTexPassElement::SRenderData data;
     data.tex = m_texture;
     data.box = {0, 0, PMONITOR->m_pixelSize.x, PMONITOR->m_pixelSize.y};
-    g_pHyprRenderer->m_sRenderPass.add(makeShared<CTexPassElement>(data));
+    g_pHyprRenderer->m_sRenderPass.emplace<CTexPassElement>(data);
 }
@@ -24,6 +24,8 @@ class CHyprMonitorDebugOverlay {
     std::chrono::high_resolution_clock::time_point m_lastFrame;
     PHLMONITORREF                                  m_monitor;
     CBox                                           m_lastDrawnBox;
+    size_t                                         m_lastDrawCalls  = 0;
+    size_t                                         m_lastDrawsSaved = 0;
 
     friend class CHyprRenderer;
 };
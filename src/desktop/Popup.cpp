@@ -171,7 +171,7 @@ void CPopup::onCommit(bool ignoreSiblings) {
         return;
     }
 
-    if (!m_windowOwner.expired() && (!m_windowOwner->m_isMapped || !m_windowOwner->m_workspace->m_visible)) {
+    if (!m_windowOwner.expired() && (!m_windowOwner->m_isMapped || !m_windowOwner->workspace()->m_visible)) {
         m_lastSize = m_resource->surface->surface->m_current.size;
 
         static auto PLOGDAMAGE = CConfigValue<Hyprlang::INT>("debug:log_damage");
@@ -437,7 +437,7 @@ void CWindow::moveToWorkspace(PHLWORKSPACE pWorkspace) {
         m_monitorMovedFrom = OLDWORKSPACE ? OLDWORKSPACE->monitorID() : -1;
     }
 
-    m_workspace = pWorkspace;
+    setWorkspace(pWorkspace);
 
     setAnimationsToMove();
 
@@ -470,6 +470,19 @@ void CWindow::moveToWorkspace(PHLWORKSPACE pWorkspace) {
     }
 }
 
+const PHLWORKSPACE& CWindow::workspace() const {
+    return m_workspace;
+}
+
+// only assigns, doesn't move anything. The only writer of m_workspace, so the per-workspace lists get rebuilt
+void CWindow::setWorkspace(PHLWORKSPACE pWorkspace) {
+    if (m_workspace == pWorkspace)
+        return;
+
+    m_workspace = pWorkspace;
+    g_pCompositor->invalidateWorkspaceWindows();
+}
+
 PHLWINDOW CWindow::x11TransientFor() {
     if (!m_xwaylandSurface || !m_xwaylandSurface->parent)
         return nullptr;
@@ -536,7 +549,7 @@ void CWindow::onUnmap() {
     g_pLayoutManager->getCurrentLayout()->recalculateMonitor(monitorID());
     g_pCompositor->updateAllWindowsAnimatedDecorationValues();
 
-    m_workspace.reset();
+    setWorkspace(nullptr);
 
     if (m_isX11)
         return;
@@ -1036,7 +1049,7 @@ void CWindow::setGroupCurrent(PHLWINDOW pWindow) {
 
     const auto PCURRENT   = getGroupCurrent();
     const bool FULLSCREEN = PCURRENT->isFullscreen();
-    const auto WORKSPACE  = PCURRENT->m_workspace;
+    const auto WORKSPACE  = PCURRENT->workspace();
     const auto MODE       = PCURRENT->m_fullscreenState.internal;
 
     const auto CURRENTISFOCUS = PCURRENT == g_pCompositor->m_lastWindow.lock();
@@ -1580,7 +1593,7 @@ void CWindow::onX11ConfigureRequest(CBox box) {
     if (!m_workspace || !m_workspace->isVisible())
         return; // further things are only for visible windows
 
-    m_workspace = g_pCompositor->getMonitorFromVector(m_realPosition->goal() + m_realSize->goal() / 2.f)->m_activeWorkspace;
+    setWorkspace(g_pCompositor->getMonitorFromVector(m_realPosition->goal() + m_realSize->goal() / 2.f)->m_activeWorkspace);
 
     g_pCompositor->changeWindowZOrder(m_self.lock(), true);
 
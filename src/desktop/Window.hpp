@@ -191,7 +191,6 @@ class CWindow {
     std::string      m_class           = "";
     std::string      m_initialTitle    = "";
     std::string      m_initialClass    = "";
-    PHLWORKSPACE     m_workspace;
     PHLMONITORREF    m_monitor;
 
     bool             m_isMapped = false;
@@ -335,6 +334,8 @@ class CWindow {
     void                       updateToplevel();
     void                       updateSurfaceScaleTransformDetails(bool force = false);
     void                       moveToWorkspace(PHLWORKSPACE);
+    const PHLWORKSPACE&        workspace() const;
+    void                       setWorkspace(PHLWORKSPACE);
     PHLWINDOW                  x11TransientFor();
     void                       onUnmap();
     void                       onMap();
@@ -443,6 +444,9 @@ class CWindow {
     bool        m_hidden        = false;
     bool        m_suspended     = false;
     WORKSPACEID m_lastWorkspace = WORKSPACE_INVALID;
+
+    // only written by setWorkspace(), so the per-workspace window lists stay in sync
+    PHLWORKSPACE m_workspace;
 };
 
 inline bool valid(PHLWINDOW w) {
@@ -534,7 +538,7 @@ struct std::formatter<PHLWINDOW, CharT> : std::formatter<CharT> {
         std::format_to(out, "[");
         std::format_to(out, "Window {:x}: title: \"{}\"", (uintptr_t)w.get(), w->m_title);
         if (formatWorkspace)
-            std::format_to(out, ", workspace: {}", w->m_workspace ? w->workspaceID() : WORKSPACE_INVALID);
+            std::format_to(out, ", workspace: {}", w->workspace() ? w->workspaceID() : WORKSPACE_INVALID);
         if (formatMonitor)
             std::format_to(out, ", monitor: {}", w->monitorID());
         if (formatClass)
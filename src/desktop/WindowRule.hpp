@@ -3,6 +3,7 @@
 #include <string>
 #include <cstdint>
 #include "Rule.hpp"
+#include "WorkspaceSelector.hpp"
 
 class CWindowRule {
   public:
@@ -70,4 +71,7 @@ class CWindowRule {
     CRuleRegexContainer m_initialTitleRegex;
     CRuleRegexContainer m_initialClassRegex;
     CRuleRegexContainer m_v1Regex;
+
+    // compiled m_onWorkspace
+    CWorkspaceSelector m_onWorkspaceSelector;
 };
\ No newline at end of file
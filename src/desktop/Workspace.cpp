@@ -1,4 +1,5 @@
 #include "Workspace.hpp"
+#include "WorkspaceSelector.hpp"
 #include "../Compositor.hpp"
 #include "../config/ConfigValue.hpp"
 #include "config/ConfigManager.hpp"
@@ -229,283 +230,12 @@ std::string CWorkspace::getConfigName() {
     return "name:" + m_name;
 }
 
-bool CWorkspace::matchesStaticSelector(const std::string& selector_) {
-    auto selector = trim(selector_);
-
-    if (selector.empty())
-        return true;
-
-    if (isNumber(selector)) {
-        const auto& [wsid, wsname] = getWorkspaceIDNameFromString(selector);
-
-        if (wsid == WORKSPACE_INVALID)
-            return false;
-
-        return wsid == m_id;
-
-    } else if (selector.starts_with("name:")) {
-        return m_name == selector.substr(5);
-    } else if (selector.starts_with("special")) {
-        return m_name == selector;
-    } else {
-        // parse selector
-
-        for (size_t i = 0; i < selector.length(); ++i) {
-            const char& cur = selector[i];
-            if (std::isspace(cur))
-                continue;
-
-            // Allowed selectors:
-            // r - range: r[1-5]
-            // s - special: s[true]
-            // n - named: n[true] or n[s:string] or n[e:string]
-            // m - monitor: m[monitor_selector]
-            // w - windowCount: w[1-4] or w[1], optional flag t or f for tiled or floating and
-            //                  flag p to count only pinned windows, e.g. w[p1-2], w[pg4]
-            //                  flag g to count groups instead of windows, e.g. w[t1-2], w[fg4]
-            //                  flag v will count only visible windows
-            // f - fullscreen state : f[-1], f[0], f[1], or f[2] for different fullscreen states
-            //                        -1: no fullscreen, 0: fullscreen, 1: maximized, 2: fullscreen without sending fs state to window
-
-            const auto  CLOSING_BRACKET = selector.find_first_of(']', i);
-            std::string prop            = selector.substr(i, CLOSING_BRACKET == std::string::npos ? std::string::npos : CLOSING_BRACKET + 1 - i);
-            i                           = std::min(CLOSING_BRACKET, std::string::npos - 1);
-
-            if (cur == 'r') {
-                WORKSPACEID from = 0, to = 0;
-                if (!prop.starts_with("r[") || !prop.ends_with("]")) {
-                    Debug::log(LOG, "Invalid selector {}", selector);
-                    return false;
-                }
-
-                prop = prop.substr(2, prop.length() - 3);
-
-                if (!prop.contains("-")) {
-                    Debug::log(LOG, "Invalid selector {}", selector);
-                    return false;
-                }
-
-                const auto DASHPOS = prop.find('-');
-                const auto LHS = prop.substr(0, DASHPOS), RHS = prop.substr(DASHPOS + 1);
-
-                if (!isNumber(LHS) || !isNumber(RHS)) {
-                    Debug::log(LOG, "Invalid selector {}", selector);
-                    return false;
-                }
-
-                try {
-                    from = std::stoll(LHS);
-                    to   = std::stoll(RHS);
-                } catch (std::exception& e) {
-                    Debug::log(LOG, "Invalid selector {}", selector);
-                    return false;
-                }
-
-                if (to < from || to < 1 || from < 1) {
-                    Debug::log(LOG, "Invalid selector {}", selector);
-                    return false;
-                }
-
-                if (std::clamp(m_id, from, to) != m_id)
-                    return false;
-                continue;
-            }
-
-            if (cur == 's') {
-                if (!prop.starts_with("s[") || !prop.ends_with("]")) {
-                    Debug::log(LOG, "Invalid selector {}", selector);
-                    return false;
-                }
-
-                prop = prop.substr(2, prop.length() - 3);
-
-                const auto SHOULDBESPECIAL = configStringToInt(prop);
-
-                if (SHOULDBESPECIAL && (bool)*SHOULDBESPECIAL != m_isSpecialWorkspace)
-                    return false;
-                continue;
-            }
-
-            if (cur == 'm') {
-                if (!prop.starts_with("m[") || !prop.ends_with("]")) {
-                    Debug::log(LOG, "Invalid selector {}", selector);
-                    return false;
-                }
-
-                prop = prop.substr(2, prop.length() - 3);
-
-                const auto PMONITOR = g_pCompositor->getMonitorFromString(prop);
-
-                if (!(PMONITOR ? PMONITOR == m_monitor : false))
-                    return false;
-                continue;
-            }
-
-            if (cur == 'n') {
-                if (!prop.starts_with("n[") || !prop.ends_with("]")) {
-                    Debug::log(LOG, "Invalid selector {}", selector);
-                    return false;
-                }
-
-                prop = prop.substr(2, prop.length() - 3);
-
-                if (prop.starts_with("s:") && !m_name.starts_with(prop.substr(2)))
-                    return false;
-                if (prop.starts_with("e:") && !m_name.ends_with(prop.substr(2)))
-                    return false;
-
-                const auto WANTSNAMED = configStringToInt(prop);
-
-                if (WANTSNAMED && *WANTSNAMED != (m_id <= -1337))
-                    return false;
-                continue;
-            }
-
-            if (cur == 'w') {
-                WORKSPACEID from = 0, to = 0;
-                if (!prop.starts_with("w[") || !prop.ends_with("]")) {
-                    Debug::log(LOG, "Invalid selector {}", selector);
-                    return false;
-                }
-
-                prop = prop.substr(2, prop.length() - 3);
-
-                int  wantsOnlyTiled    = -1;
-                int  wantsOnlyPinned   = false;
-                bool wantsCountGroup   = false;
-                bool wantsCountVisible = false;
-
-                int  flagCount = 0;
-                for (auto const& flag : prop) {
-                    if (flag == 't' && wantsOnlyTiled == -1) {
-                        wantsOnlyTiled = 1;
-                        flagCount++;
-                    } else if (flag == 'f' && wantsOnlyTiled == -1) {
-                        wantsOnlyTiled = 0;
-                        flagCount++;
-                    } else if (flag == 'p' && !wantsOnlyPinned) {
-                        wantsOnlyPinned = true;
-                        flagCount++;
-                    } else if (flag == 'g' && !wantsCountGroup) {
-                        wantsCountGroup = true;
-                        flagCount++;
-                    } else if (flag == 'v' && !wantsCountVisible) {
-                        wantsCountVisible = true;
-                        flagCount++;
-                    } else {
-                        break;
-                    }
-                }
-                prop = prop.substr(flagCount);
-
-                if (!prop.contains("-")) {
-                    // try single
-
-                    if (!isNumber(prop)) {
-                        Debug::log(LOG, "Invalid selector {}", selector);
-                        return false;
-                    }
-
-                    try {
-                        from = std::stoll(prop);
-                    } catch (std::exception& e) {
-                        Debug::log(LOG, "Invalid selector {}", selector);
-                        return false;
-                    }
-
-                    int count;
-                    if (wantsCountGroup)
-                        count = getGroups(wantsOnlyTiled == -1 ? std::nullopt : std::optional<bool>((bool)wantsOnlyTiled),
-                                          wantsOnlyPinned ? std::optional<bool>(wantsOnlyPinned) : std::nullopt,
-                                          wantsCountVisible ? std::optional<bool>(wantsCountVisible) : std::nullopt);
-                    else
-                        count = getWindows(wantsOnlyTiled == -1 ? std::nullopt : std::optional<bool>((bool)wantsOnlyTiled),
-                                           wantsOnlyPinned ? std::optional<bool>(wantsOnlyPinned) : std::nullopt,
-                                           wantsCountVisible ? std::optional<bool>(wantsCountVisible) : std::nullopt);
-
-                    if (count != from)
-                        return false;
-                    continue;
-                }
-
-                const auto DASHPOS = prop.find('-');
-                const auto LHS = prop.substr(0, DASHPOS), RHS = prop.substr(DASHPOS + 1);
-
-                if (!isNumber(LHS) || !isNumber(RHS)) {
-                    Debug::log(LOG, "Invalid selector {}", selector);
-                    return false;
-                }
-
-                try {
-                    from = std::stoll(LHS);
-                    to   = std::stoll(RHS);
-                } catch (std::exception& e) {
-                    Debug::log(LOG, "Invalid selector {}", selector);
-                    return false;
-                }
-
-                if (to < from || to < 1 || from < 1) {
-                    Debug::log(LOG, "Invalid selector {}", selector);
-                    return false;
-                }
-
-                WORKSPACEID count;
-                if (wantsCountGroup)
-                    count =
-                        getGroups(wantsOnlyTiled == -1 ? std::nullopt : std::optional<bool>((bool)wantsOnlyTiled),
-                                  wantsOnlyPinned ? std::optional<bool>(wantsOnlyPinned) : std::nullopt, wantsCountVisible ? std::optional<bool>(wantsCountVisible) : std::nullopt);
-                else
-                    count = getWindows(wantsOnlyTiled == -1 ? std::nullopt : std::optional<bool>((bool)wantsOnlyTiled),
-                                       wantsOnlyPinned ? std::optional<bool>(wantsOnlyPinned) : std::nullopt,
-                                       wantsCountVisible ? std::optional<bool>(wantsCountVisible) : std::nullopt);
-
-                if (std::clamp(count, from, to) != count)
-                    return false;
-                continue;
-            }
-
-            if (cur == 'f') {
-                if (!prop.starts_with("f[") || !prop.ends_with("]")) {
-                    Debug::log(LOG, "Invalid selector {}", selector);
-                    return false;
-                }
-
-                prop        = prop.substr(2, prop.length() - 3);
-                int FSSTATE = -1;
-                try {
-                    FSSTATE = std::stoi(prop);
-                } catch (std::exception& e) {
-                    Debug::log(LOG, "Invalid selector {}", selector);
-                    return false;
-                }
-
-                switch (FSSTATE) {
-                    case -1: // no fullscreen
-                        if (m_hasFullscreenWindow)
-                            return false;
-                        break;
-                    case 0: // fullscreen full
-                        if (!m_hasFullscreenWindow || m_fullscreenMode != FSMODE_FULLSCREEN)
-                            return false;
-                        break;
-                    case 1: // maximized
-                        if (!m_hasFullscreenWindow || m_fullscreenMode != FSMODE_MAXIMIZED)
-                            return false;
-                        break;
-                    default: break;
-                }
-                continue;
-            }
-
-            Debug::log(LOG, "Invalid selector {}", selector);
-            return false;
-        }
-
-        return true;
-    }
+bool CWorkspace::matchesStaticSelector(const std::string& selector) {
+    return CWorkspaceSelector::get(selector).matches(*this);
+}
 
-    UNREACHABLE();
-    return false;
+bool CWorkspace::matchesStaticSelector(const CWorkspaceSelector& selector) {
+    return selector.matches(*this);
 }
 
 void CWorkspace::markInert() {
@@ -524,8 +254,9 @@ MONITORID CWorkspace::monitorID() {
 }
 
 PHLWINDOW CWorkspace::getFullscreenWindow() {
-    for (auto const& w : g_pCompositor->m_windows) {
-        if (w->m_workspace == m_self && w->isFullscreen())
+    for (auto const& ref : windows()) {
+        const auto w = ref.lock();
+        if (w && w->isFullscreen())
             return w;
     }
 
@@ -546,8 +277,9 @@ bool CWorkspace::isVisibleNotCovered() {
 
 int CWorkspace::getWindows(std::optional<bool> onlyTiled, std::optional<bool> onlyPinned, std::optional<bool> onlyVisible) {
     int no = 0;
-    for (auto const& w : g_pCompositor->m_windows) {
-        if (w->workspaceID() != m_id || !w->m_isMapped)
+    for (auto const& ref : windows()) {
+        const auto w = ref.lock();
+        if (!w || !w->m_isMapped)
             continue;
         if (onlyTiled.has_value() && w->m_isFloating == onlyTiled.value())
             continue;
@@ -563,8 +295,9 @@ int CWorkspace::getWindows(std::optional<bool> onlyTiled, std::optional<bool> on
 
 int CWorkspace::getGroups(std::optional<bool> onlyTiled, std::optional<bool> onlyPinned, std::optional<bool> onlyVisible) {
     int no = 0;
-    for (auto const& w : g_pCompositor->m_windows) {
-        if (w->workspaceID() != m_id || !w->m_isMapped)
+    for (auto const& ref : windows()) {
+        const auto w = ref.lock();
+        if (!w || !w->m_isMapped)
             continue;
         if (!w->m_groupData.head)
             continue;
@@ -580,8 +313,9 @@ int CWorkspace::getGroups(std::optional<bool> onlyTiled, std::optional<bool> onl
 }
 
 PHLWINDOW CWorkspace::getFirstWindow() {
-    for (auto const& w : g_pCompositor->m_windows) {
-        if (w->m_workspace == m_self && w->m_isMapped && !w->isHidden())
+    for (auto const& ref : windows()) {
+        const auto w = ref.lock();
+        if (w && w->m_isMapped && !w->isHidden())
             return w;
     }
 
@@ -591,8 +325,9 @@ PHLWINDOW CWorkspace::getFirstWindow() {
 PHLWINDOW CWorkspace::getTopLeftWindow() {
     const auto PMONITOR = m_monitor.lock();
 
-    for (auto const& w : g_pCompositor->m_windows) {
-        if (w->m_workspace != m_self || !w->m_isMapped || w->isHidden())
+    for (auto const& ref : windows()) {
+        const auto w = ref.lock();
+        if (!w || !w->m_isMapped || w->isHidden())
             continue;
 
         const auto WINDOWIDEALBB = w->getWindowIdealBoundingBoxIgnoreReserved();
@@ -604,8 +339,9 @@ PHLWINDOW CWorkspace::getTopLeftWindow() {
 }
 
 bool CWorkspace::hasUrgentWindow() {
-    for (auto const& w : g_pCompositor->m_windows) {
-        if (w->m_workspace == m_self && w->m_isMapped && w->m_isUrgent)
+    for (auto const& ref : windows()) {
+        const auto w = ref.lock();
+        if (w && w->m_isMapped && w->m_isUrgent)
             return true;
     }
 
@@ -613,8 +349,12 @@ bool CWorkspace::hasUrgentWindow() {
 }
 
 void CWorkspace::updateWindowDecos() {
-    for (auto const& w : g_pCompositor->m_windows) {
-        if (w->m_workspace != m_self)
+    // copy, the callees may end up moving windows around
+    const auto WINDOWS = windows();
+
+    for (auto const& ref : WINDOWS) {
+        const auto w = ref.lock();
+        if (!w || w->workspace() != m_self)
             continue;
 
         w->updateWindowDecos();
@@ -624,8 +364,11 @@ void CWorkspace::updateWindowDecos() {
 void CWorkspace::updateWindowData() {
     const auto WORKSPACERULE = g_pConfigManager->getWorkspaceRuleFor(m_self.lock());
 
-    for (auto const& w : g_pCompositor->m_windows) {
-        if (w->m_workspace != m_self)
+    const auto WINDOWS       = windows();
+
+    for (auto const& ref : WINDOWS) {
+        const auto w = ref.lock();
+        if (!w || w->workspace() != m_self)
             continue;
 
         w->updateWindowData(WORKSPACERULE);
@@ -633,8 +376,11 @@ void CWorkspace::updateWindowData() {
 }
 
 void CWorkspace::forceReportSizesToWindows() {
-    for (auto const& w : g_pCompositor->m_windows) {
-        if (w->m_workspace != m_self || !w->m_isMapped || w->isHidden())
+    const auto WINDOWS = windows();
+
+    for (auto const& ref : WINDOWS) {
+        const auto w = ref.lock();
+        if (!w || w->workspace() != m_self || !w->m_isMapped || w->isHidden())
             continue;
 
         w->sendWindowSize(true);
@@ -658,12 +404,42 @@ void CWorkspace::rename(const std::string& name) {
 }
 
 void CWorkspace::updateWindows() {
-    m_hasFullscreenWindow = std::ranges::any_of(g_pCompositor->m_windows, [this](const auto& w) { return w->m_isMapped && w->m_workspace == m_self && w->isFullscreen(); });
+    const auto WINDOWS = windows();
 
-    for (auto const& w : g_pCompositor->m_windows) {
-        if (!w->m_isMapped || w->m_workspace != m_self)
+    m_hasFullscreenWindow = std::ranges::any_of(WINDOWS, [](const auto& ref) { return ref && ref->m_isMapped && ref->isFullscreen(); });
+
+    for (auto const& ref : WINDOWS) {
+        const auto w = ref.lock();
+        if (!w || !w->m_isMapped || w->workspace() != m_self)
             continue;
 
         w->updateDynamicRules();
     }
 }
+
+const std::vector<PHLWINDOWREF>& CWorkspace::windows() {
+    g_pCompositor->updateWorkspaceWindows();
+
+#if ISDEBUG
+    validateWindows();
+#endif
+
+    return m_windows;
+}
+
+// checks the list against a full scan, catches the window lists going stale without setWorkspace()
+void CWorkspace::validateWindows() {
+    std::vector<PHLWINDOWREF> expected;
+    for (auto const& w : g_pCompositor->m_windows) {
+        if (w->workspace() == m_self)
+            expected.emplace_back(w);
+    }
+
+    if (expected == m_windows)
+        return;
+
+    Debug::log(ERR, "BUG THIS: window list of workspace {} ({}) is out of sync, has {} windows, expected {}", m_id, m_name, m_windows.size(), expected.size());
+
+    m_windows = std::move(expected);
+    g_pCompositor->invalidateWorkspaceWindows();
+}
@@ -14,6 +14,7 @@ enum eFullscreenMode : int8_t {
 };
 
 class CWindow;
+class CWorkspaceSelector;
 
 class CWorkspace {
   public:
@@ -68,6 +69,7 @@ class CWorkspace {
     void             rememberPrevWorkspace(const PHLWORKSPACE& prevWorkspace);
     std::string      getConfigName();
     bool             matchesStaticSelector(const std::string& selector);
+    bool             matchesStaticSelector(const CWorkspaceSelector& selector);
     void             markInert();
     SWorkspaceIDName getPrevWorkspaceIDName() const;
     void             updateWindowDecos();
@@ -84,6 +86,9 @@ class CWorkspace {
     void             forceReportSizesToWindows();
     void             updateWindows();
 
+    // windows assigned to this workspace, bottom to top, mapped or not
+    const std::vector<PHLWINDOWREF>& windows();
+
   private:
     void init(PHLWORKSPACE self);
     // Previous workspace ID and name is stored during a workspace change, allowing travel
@@ -93,6 +98,12 @@ class CWorkspace {
     SP<HOOK_CALLBACK_FN> m_focusedWindowHook;
     bool                 m_inert = true;
     WP<CWorkspace>       m_self;
+
+    // rebuilt by CCompositor::updateWorkspaceWindows() after a window changes workspace, z-order or goes away
+    std::vector<PHLWINDOWREF> m_windows;
+    void                      validateWindows();
+
+    friend class CCompositor;
 };
 
 inline bool valid(const PHLWORKSPACE& ref) {
@@ -0,0 +1,246 @@
+#include "WorkspaceSelector.hpp"
+#include "Workspace.hpp"
+#include "../Compositor.hpp"
+#include <hyprutils/string/String.hpp>
+#include <algorithm>
+#include <unordered_map>
+using namespace Hyprutils::String;
+
+constexpr size_t MAX_CACHED_SELECTORS = 512;
+
+static bool      parseRange(const std::string& str, WORKSPACEID& from, WORKSPACEID& to) {
+    const auto DASHPOS = str.find('-');
+    const auto LHS = str.substr(0, DASHPOS), RHS = str.substr(DASHPOS + 1);
+
+    if (!isNumber(LHS) || !isNumber(RHS))
+        return false;
+
+    try {
+        from = std::stoll(LHS);
+        to   = std::stoll(RHS);
+    } catch (std::exception& e) { return false; }
+
+    return to >= from && to >= 1 && from >= 1;
+}
+
+CWorkspaceSelector::CWorkspaceSelector(const std::string& selector_) {
+    const auto selector = trim(selector_);
+
+    if (selector.empty())
+        m_type = SELECTOR_ANY;
+    else if (isNumber(selector)) {
+        if (selector.starts_with('+') || selector.starts_with('-')) {
+            m_type   = SELECTOR_RELATIVE_ID;
+            m_string = selector;
+            return;
+        }
+
+        try {
+            m_id   = std::max(std::stoi(selector), 1);
+            m_type = SELECTOR_ID;
+        } catch (std::exception& e) { m_type = SELECTOR_INVALID; }
+    } else if (selector.starts_with("name:")) {
+        m_type   = SELECTOR_NAME;
+        m_string = selector.substr(5);
+    } else if (selector.starts_with("special")) {
+        m_type   = SELECTOR_NAME;
+        m_string = selector;
+    } else {
+        m_type = SELECTOR_PREDICATES;
+
+        if (!compilePredicates(selector)) {
+            Debug::log(LOG, "Invalid selector {}", selector);
+            m_type = SELECTOR_INVALID;
+            m_predicates.clear();
+        }
+    }
+}
+
+bool CWorkspaceSelector::compilePredicates(const std::string& selector) {
+    for (size_t i = 0; i < selector.length(); ++i) {
+        const char cur = selector[i];
+        if (std::isspace(cur))
+            continue;
+
+        // Allowed selectors:
+        // r - range: r[1-5]
+        // s - special: s[true]
+        // n - named: n[true] or n[s:string] or n[e:string]
+        // m - monitor: m[monitor_selector]
+        // w - windowCount: w[1-4] or w[1], optional flag t or f for tiled or floating and
+        //                  flag p to count only pinned windows, e.g. w[p1-2], w[pg4]
+        //                  flag g to count groups instead of windows, e.g. w[t1-2], w[fg4]
+        //                  flag v will count only visible windows
+        // f - fullscreen state : f[-1], f[0], f[1], or f[2] for different fullscreen states
+        //                        -1: no fullscreen, 0: fullscreen, 1: maximized, 2: fullscreen without sending fs state to window
+
+        const auto  CLOSING_BRACKET = selector.find_first_of(']', i);
+        std::string prop            = selector.substr(i, CLOSING_BRACKET == std::string::npos ? std::string::npos : CLOSING_BRACKET + 1 - i);
+        i                           = std::min(CLOSING_BRACKET, std::string::npos - 1);
+
+        if (!std::string_view{"rsmnwf"}.contains(cur) || prop.length() < 3 || prop[1] != '[' || !prop.ends_with("]"))
+            return false;
+
+        prop = prop.substr(2, prop.length() - 3);
+
+        SPredicate predicate;
+
+        switch (cur) {
+            case 'r':
+                if (!prop.contains("-") || !parseRange(prop, predicate.from, predicate.to))
+                    return false;
+
+                predicate.type = PREDICATE_RANGE;
+                break;
+            case 's': {
+                const auto SHOULDBESPECIAL = configStringToInt(prop);
+                if (!SHOULDBESPECIAL)
+                    continue;
+
+                predicate.type = PREDICATE_SPECIAL;
+                predicate.from = (bool)*SHOULDBESPECIAL;
+                break;
+            }
+            case 'm':
+                predicate.type = PREDICATE_MONITOR;
+                predicate.str  = prop;
+                break;
+            case 'n': {
+                if (prop.starts_with("s:"))
+                    m_predicates.emplace_back(SPredicate{.type = PREDICATE_NAME_PREFIX, .str = prop.substr(2)});
+                if (prop.starts_with("e:"))
+                    m_predicates.emplace_back(SPredicate{.type = PREDICATE_NAME_SUFFIX, .str = prop.substr(2)});
+
+                const auto WANTSNAMED = configStringToInt(prop);
+                if (!WANTSNAMED)
+                    continue;
+
+                predicate.type = PREDICATE_NAMED;
+                predicate.from = *WANTSNAMED;
+                break;
+            }
+            case 'w': {
+                predicate.type = PREDICATE_WINDOWS;
+
+                int flagCount = 0;
+                for (auto const& flag : prop) {
+                    if (flag == 't' && !predicate.onlyTiled)
+                        predicate.onlyTiled = true;
+                    else if (flag == 'f' && !predicate.onlyTiled)
+                        predicate.onlyTiled = false;
+                    else if (flag == 'p' && !predicate.onlyPinned)
+                        predicate.onlyPinned = true;
+                    else if (flag == 'g' && !predicate.countGroups)
+                        predicate.countGroups = true;
+                    else if (flag == 'v' && !predicate.onlyVisible)
+                        predicate.onlyVisible = true;
+                    else
+                        break;
+
+                    flagCount++;
+                }
+                prop = prop.substr(flagCount);
+
+                if (prop.contains("-")) {
+                    if (!parseRange(prop, predicate.from, predicate.to))
+                        return false;
+                    break;
+                }
+
+                // single count
+                if (!isNumber(prop))
+                    return false;
+
+                try {
+                    predicate.from = std::stoll(prop);
+                    predicate.to   = predicate.from;
+                } catch (std::exception& e) { return false; }
+                break;
+            }
+            case 'f': {
+                int fsState = -1;
+                try {
+                    fsState = std::stoi(prop);
+                } catch (std::exception& e) { return false; }
+
+                // anything else doesn't constrain
+                if (fsState < -1 || fsState > 1)
+                    continue;
+
+                predicate.type = PREDICATE_FULLSCREEN;
+                predicate.from = fsState;
+                break;
+            }
+            default: return false;
+        }
+
+        m_predicates.emplace_back(std::move(predicate));
+    }
+
+    return true;
+}
+
+bool CWorkspaceSelector::passes(const SPredicate& predicate, CWorkspace& workspace) const {
+    switch (predicate.type) {
+        case PREDICATE_RANGE: return std::clamp(workspace.m_id, predicate.from, predicate.to) == workspace.m_id;
+        case PREDICATE_SPECIAL: return (bool)predicate.from == workspace.m_isSpecialWorkspace;
+        case PREDICATE_MONITOR: {
+            const auto PMONITOR = g_pCompositor->getMonitorFromString(predicate.str);
+            return PMONITOR && PMONITOR == workspace.m_monitor;
+        }
+        case PREDICATE_NAME_PREFIX: return workspace.m_name.starts_with(predicate.str);
+        case PREDICATE_NAME_SUFFIX: return workspace.m_name.ends_with(predicate.str);
+        case PREDICATE_NAMED: return predicate.from == (workspace.m_id <= -1337);
+        case PREDICATE_WINDOWS: {
+            const WORKSPACEID COUNT = predicate.countGroups ? workspace.getGroups(predicate.onlyTiled, predicate.onlyPinned, predicate.onlyVisible) :
+                                                             workspace.getWindows(predicate.onlyTiled, predicate.onlyPinned, predicate.onlyVisible);
+            return std::clamp(COUNT, predicate.from, predicate.to) == COUNT;
+        }
+        case PREDICATE_FULLSCREEN:
+            switch (predicate.from) {
+                case -1: return !workspace.m_hasFullscreenWindow;
+                case 0: return workspace.m_hasFullscreenWindow && workspace.m_fullscreenMode == FSMODE_FULLSCREEN;
+                case 1: return workspace.m_hasFullscreenWindow && workspace.m_fullscreenMode == FSMODE_MAXIMIZED;
+                default: return true;
+            }
+    }
+
+    return false;
+}
+
+bool CWorkspaceSelector::matches(CWorkspace& workspace) const {
+    switch (m_type) {
+        case SELECTOR_ANY: return true;
+        case SELECTOR_INVALID: return false;
+        case SELECTOR_ID: return m_id == workspace.m_id;
+        case SELECTOR_RELATIVE_ID: {
+            const auto& [wsid, wsname] = getWorkspaceIDNameFromString(m_string);
+            return wsid != WORKSPACE_INVALID && wsid == workspace.m_id;
+        }
+        case SELECTOR_NAME: return workspace.m_name == m_string;
+        case SELECTOR_PREDICATES: return std::ranges::all_of(m_predicates, [&](const auto& p) { return passes(p, workspace); });
+    }
+
+    return false;
+}
+
+bool CWorkspaceSelector::valid() const {
+    return m_type != SELECTOR_INVALID;
+}
+
+static std::unordered_map<std::string, CWorkspaceSelector> selectorCache;
+
+const CWorkspaceSelector&                                  CWorkspaceSelector::get(const std::string& selector) {
+    if (const auto IT = selectorCache.find(selector); IT != selectorCache.end())
+        return IT->second;
+
+    // selectors mostly come from the config, this only guards against ipc callers passing endless unique ones
+    if (selectorCache.size() >= MAX_CACHED_SELECTORS)
+        selectorCache.clear();
+
+    return selectorCache.emplace(selector, CWorkspaceSelector{selector}).first->second;
+}
+
+void CWorkspaceSelector::clearCache() {
+    selectorCache.clear();
+}
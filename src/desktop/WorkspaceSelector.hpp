@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+#include "../defines.hpp"
+
+class CWorkspace;
+
+/*
+    A static workspace selector (workspace rules, windowrule onworkspace, ...)
+    parsed once into a list of typed predicates that all have to pass.
+    Matching does no parsing; only m[] resolves its monitor at match time,
+    as monitors come and go, and relative ids (+1, -1) resolve against the
+    current workspace.
+*/
+class CWorkspaceSelector {
+  public:
+    CWorkspaceSelector() = default; // matches everything
+    CWorkspaceSelector(const std::string& selector);
+
+    bool                             matches(CWorkspace& workspace) const;
+    bool                             valid() const;
+
+    // for callers that only have the string, compiled once and kept until the next config reload
+    static const CWorkspaceSelector& get(const std::string& selector);
+    static void                      clearCache();
+
+  private:
+    enum eSelectorType : uint8_t {
+        SELECTOR_ANY = 0,
+        SELECTOR_INVALID,
+        SELECTOR_ID,
+        SELECTOR_RELATIVE_ID,
+        SELECTOR_NAME,
+        SELECTOR_PREDICATES,
+    };
+
+    enum ePredicateType : uint8_t {
+        PREDICATE_RANGE = 0,
+        PREDICATE_SPECIAL,
+        PREDICATE_MONITOR,
+        PREDICATE_NAME_PREFIX,
+        PREDICATE_NAME_SUFFIX,
+        PREDICATE_NAMED,
+        PREDICATE_WINDOWS,
+        PREDICATE_FULLSCREEN,
+    };
+
+    struct SPredicate {
+        ePredicateType      type = PREDICATE_RANGE;
+        WORKSPACEID         from = 0, to = 0; // r[], w[] and the expected value of s[] / n[] / f[]
+        std::string         str;              // m[] monitor, n[s:] / n[e:] affix
+        std::optional<bool> onlyTiled, onlyPinned, onlyVisible;
+        bool                countGroups = false;
+    };
+
+    bool                    compilePredicates(const std::string& selector);
+    bool                    passes(const SPredicate& predicate, CWorkspace& workspace) const;
+
+    eSelectorType           m_type = SELECTOR_ANY;
+    WORKSPACEID             m_id   = WORKSPACE_INVALID;
+    std::string             m_string; // name for SELECTOR_NAME, the selector for SELECTOR_RELATIVE_ID
+    std::vector<SPredicate> m_predicates;
+};
@@ -1,10 +1,10 @@
 #include "IKeyboard.hpp"
+#include "KeymapCache.hpp"
 #include "../defines.hpp"
 #include "../helpers/varlist/VarList.hpp"
 #include "../managers/input/InputManager.hpp"
 #include "../managers/SeatManager.hpp"
 #include "../config/ConfigManager.hpp"
-#include <sys/mman.h>
 #include <aquamarine/input/Input.hpp>
 #include <cstring>
 
@@ -51,6 +51,7 @@ void IKeyboard::clearManuallyAllocd() {
     m_xkbState       = nullptr;
     m_xkbStaticState = nullptr;
     m_xkbKeymapFD.reset();
+    m_compiledKeymap.reset();
 }
 
 void IKeyboard::setKeymap(const SStringRuleNames& rules) {
@@ -59,48 +60,21 @@ void IKeyboard::setKeymap(const SStringRuleNames& rules) {
         return;
     }
 
-    m_currentRules          = rules;
-    xkb_rule_names XKBRULES = {
-        .rules   = rules.rules.c_str(),
-        .model   = rules.model.c_str(),
-        .layout  = rules.layout.c_str(),
-        .variant = rules.variant.c_str(),
-        .options = rules.options.c_str(),
-    };
-
-    const auto CONTEXT = xkb_context_new(XKB_CONTEXT_NO_FLAGS);
-
-    if (!CONTEXT) {
-        Debug::log(ERR, "setKeymap: CONTEXT null??");
-        return;
-    }
+    m_currentRules = rules;
 
     clearManuallyAllocd();
 
     Debug::log(LOG, "Attempting to create a keymap for layout {} with variant {} (rules: {}, model: {}, options: {})", rules.layout, rules.variant, rules.rules, rules.model,
                rules.options);
 
-    if (!m_xkbFilePath.empty()) {
-        auto path = absolutePath(m_xkbFilePath, g_pConfigManager->m_configCurrentPath);
+    auto keymap = CKeymapCache::get(rules, m_xkbFilePath);
 
-        if (FILE* const KEYMAPFILE = fopen(path.c_str(), "r"); !KEYMAPFILE)
-            Debug::log(ERR, "Cannot open input:kb_file= file for reading");
-        else {
-            m_xkbKeymap = xkb_keymap_new_from_file(CONTEXT, KEYMAPFILE, XKB_KEYMAP_FORMAT_TEXT_V1, XKB_KEYMAP_COMPILE_NO_FLAGS);
-            fclose(KEYMAPFILE);
-        }
-    }
-
-    if (!m_xkbKeymap)
-        m_xkbKeymap = xkb_keymap_new_from_names(CONTEXT, &XKBRULES, XKB_KEYMAP_COMPILE_NO_FLAGS);
-
-    if (!m_xkbKeymap) {
+    if (!keymap->keymap) {
         g_pConfigManager->addParseError("Invalid keyboard layout passed. ( rules: " + rules.rules + ", model: " + rules.model + ", variant: " + rules.variant +
                                         ", options: " + rules.options + ", layout: " + rules.layout + " )");
 
         Debug::log(ERR, "Keyboard layout {} with variant {} (rules: {}, model: {}, options: {}) couldn't have been loaded.", rules.layout, rules.variant, rules.rules, rules.model,
                    rules.options);
-        memset(&XKBRULES, 0, sizeof(XKBRULES));
 
         m_currentRules.rules   = "";
         m_currentRules.model   = "";
@@ -108,9 +82,13 @@ void IKeyboard::setKeymap(const SStringRuleNames& rules) {
         m_currentRules.options = "";
         m_currentRules.layout  = "us";
 
-        m_xkbKeymap = xkb_keymap_new_from_names(CONTEXT, &XKBRULES, XKB_KEYMAP_COMPILE_NO_FLAGS);
+        // all empty is xkb's defaults
+        keymap = CKeymapCache::get({}, "");
     }
 
+    m_compiledKeymap = keymap;
+    m_xkbKeymap      = keymap->keymap ? xkb_keymap_ref(keymap->keymap) : nullptr;
+
     updateXKBTranslationState(m_xkbKeymap);
 
     const auto NUMLOCKON = g_pConfigManager->getDeviceInt(m_hlName, "numlock_by_default", "input:numlock_by_default");
@@ -136,9 +114,9 @@ void IKeyboard::setKeymap(const SStringRuleNames& rules) {
         Debug::log(LOG, "xkb: Mod index {} (name {}) got index {}", i, MODNAMES[i], m_modIndexes[i]);
     }
 
-    updateKeymapFD();
-
-    xkb_context_unref(CONTEXT);
+    // every keyboard on this keymap shares the same read-only shm
+    m_xkbKeymapString = keymap->string;
+    m_xkbKeymapFD     = keymap->fd.duplicate();
 
     g_pSeatManager->updateActiveKeyboardData();
 }
@@ -153,21 +131,7 @@ void IKeyboard::updateKeymapFD() {
     m_xkbKeymapString = cKeymapStr;
     free(cKeymapStr);
 
-    CFileDescriptor rw, ro;
-    if (!allocateSHMFilePair(m_xkbKeymapString.length() + 1, rw, ro))
-        Debug::log(ERR, "IKeyboard: failed to allocate shm pair for the keymap");
-    else {
-        auto keymapFDDest = mmap(nullptr, m_xkbKeymapString.length() + 1, PROT_READ | PROT_WRITE, MAP_SHARED, rw.get(), 0);
-        rw.reset();
-        if (keymapFDDest == MAP_FAILED) {
-            Debug::log(ERR, "IKeyboard: failed to mmap a shm pair for the keymap");
-            ro.reset();
-        } else {
-            memcpy(keymapFDDest, m_xkbKeymapString.c_str(), m_xkbKeymapString.length());
-            munmap(keymapFDDest, m_xkbKeymapString.length() + 1);
-            m_xkbKeymapFD = std::move(ro);
-        }
-    }
+    m_xkbKeymapFD = CKeymapCache::createKeymapFD(m_xkbKeymapString);
 
     Debug::log(LOG, "Updated keymap fd to {}", m_xkbKeymapFD.get());
 }
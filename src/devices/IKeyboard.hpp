@@ -10,6 +10,8 @@
 
 AQUAMARINE_FORWARD(IKeyboard);
 
+struct SCompiledKeymap;
+
 enum eKeyboardModifiers {
     HL_MODIFIER_SHIFT = (1 << 0),
     HL_MODIFIER_CAPS  = (1 << 1),
@@ -103,6 +105,7 @@ class IKeyboard : public IHID {
     std::string                    m_xkbFilePath     = "";
     std::string                    m_xkbKeymapString = "";
     Hyprutils::OS::CFileDescriptor m_xkbKeymapFD;
+    SP<SCompiledKeymap>            m_compiledKeymap; // shared with other keyboards, unset if the keymap was overridden
 
     SStringRuleNames               m_currentRules;
     int                            m_repeatRate        = 0;
@@ -0,0 +1,142 @@
+#include "KeymapCache.hpp"
+#include "../config/ConfigManager.hpp"
+#include "../helpers/MiscFunctions.hpp"
+#include <sys/mman.h>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <iterator>
+
+using namespace Hyprutils::OS;
+
+SCompiledKeymap::~SCompiledKeymap() {
+    if (keymap)
+        xkb_keymap_unref(keymap);
+}
+
+CKeymapCache::SRequest CKeymapCache::makeRequest(const IKeyboard::SStringRuleNames& rules, const std::string& filePath) {
+    SRequest request{.rules = rules};
+
+    if (!filePath.empty()) {
+        std::ifstream file(absolutePath(filePath, g_pConfigManager->m_configCurrentPath));
+
+        if (!file.good())
+            Debug::log(ERR, "Cannot open input:kb_file= file for reading");
+        else
+            request.fileContents = std::string{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    }
+
+    // the file goes in by its contents, editing it between reloads has to give a new keymap
+    request.key = std::format("{}\n{}\n{}\n{}\n{}\n{:x}:{}", rules.rules, rules.model, rules.layout, rules.variant, rules.options,
+                              std::hash<std::string>{}(request.fileContents), request.fileContents.length());
+
+    return request;
+}
+
+// runs on a worker thread, must not touch anything shared
+SP<SCompiledKeymap> CKeymapCache::compile(const SRequest& request) {
+    auto       result  = makeShared<SCompiledKeymap>();
+    const auto CONTEXT = xkb_context_new(XKB_CONTEXT_NO_FLAGS);
+
+    if (!CONTEXT)
+        return result;
+
+    if (!request.fileContents.empty())
+        result->keymap = xkb_keymap_new_from_string(CONTEXT, request.fileContents.c_str(), XKB_KEYMAP_FORMAT_TEXT_V1, XKB_KEYMAP_COMPILE_NO_FLAGS);
+
+    // a kb_file that doesn't compile falls back to the rules
+    if (!result->keymap) {
+        const xkb_rule_names XKBRULES = {
+            .rules   = request.rules.rules.c_str(),
+            .model   = request.rules.model.c_str(),
+            .layout  = request.rules.layout.c_str(),
+            .variant = request.rules.variant.c_str(),
+            .options = request.rules.options.c_str(),
+        };
+
+        result->keymap = xkb_keymap_new_from_names(CONTEXT, &XKBRULES, XKB_KEYMAP_COMPILE_NO_FLAGS);
+    }
+
+    xkb_context_unref(CONTEXT);
+
+    if (!result->keymap)
+        return result;
+
+    auto cKeymapStr = xkb_keymap_get_as_string(result->keymap, XKB_KEYMAP_FORMAT_TEXT_V1);
+    result->string  = cKeymapStr;
+    free(cKeymapStr);
+
+    return result;
+}
+
+void CKeymapCache::prefetch(const IKeyboard::SStringRuleNames& rules, const std::string& filePath) {
+    auto request = makeRequest(rules, filePath);
+
+    if (m_keymaps.contains(request.key))
+        return;
+
+    const auto KEY = request.key;
+    m_keymaps.emplace(KEY, std::async(std::launch::async, [request = std::move(request)] { return compile(request); }).share());
+}
+
+void CKeymapCache::prefetchForDevice(const std::string& deviceName) {
+    prefetch(
+        IKeyboard::SStringRuleNames{
+            .layout  = g_pConfigManager->getDeviceString(deviceName, "kb_layout", "input:kb_layout"),
+            .model   = g_pConfigManager->getDeviceString(deviceName, "kb_model", "input:kb_model"),
+            .variant = g_pConfigManager->getDeviceString(deviceName, "kb_variant", "input:kb_variant"),
+            .options = g_pConfigManager->getDeviceString(deviceName, "kb_options", "input:kb_options"),
+            .rules   = g_pConfigManager->getDeviceString(deviceName, "kb_rules", "input:kb_rules"),
+        },
+        g_pConfigManager->getDeviceString(deviceName, "kb_file", "input:kb_file"));
+}
+
+SP<SCompiledKeymap> CKeymapCache::get(const IKeyboard::SStringRuleNames& rules, const std::string& filePath) {
+    auto request = makeRequest(rules, filePath);
+    auto it      = m_keymaps.find(request.key);
+
+    // nobody prefetched it, compile on this thread when we wait on it below
+    if (it == m_keymaps.end()) {
+        const auto KEY = request.key;
+        it             = m_keymaps.emplace(KEY, std::async(std::launch::deferred, [request = std::move(request)] { return compile(request); }).share()).first;
+    }
+
+    const auto KEYMAP = it->second.get();
+
+    // the shm fd is made here and not on the worker, it's cheap and allocating it isn't thread safe
+    if (KEYMAP->keymap && !KEYMAP->fd.isValid())
+        KEYMAP->fd = createKeymapFD(KEYMAP->string);
+
+    return KEYMAP;
+}
+
+void CKeymapCache::prune() {
+    std::erase_if(m_keymaps, [](const auto& el) {
+        // still compiling, someone is about to ask for it
+        if (el.second.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            return false;
+
+        return el.second.get().strongRef() <= 1;
+    });
+}
+
+CFileDescriptor CKeymapCache::createKeymapFD(const std::string& keymap) {
+    CFileDescriptor rw, ro;
+    if (!allocateSHMFilePair(keymap.length() + 1, rw, ro)) {
+        Debug::log(ERR, "KeymapCache: failed to allocate shm pair for the keymap");
+        return {};
+    }
+
+    auto keymapFDDest = mmap(nullptr, keymap.length() + 1, PROT_READ | PROT_WRITE, MAP_SHARED, rw.get(), 0);
+    rw.reset();
+
+    if (keymapFDDest == MAP_FAILED) {
+        Debug::log(ERR, "KeymapCache: failed to mmap a shm pair for the keymap");
+        return {};
+    }
+
+    memcpy(keymapFDDest, keymap.c_str(), keymap.length());
+    munmap(keymapFDDest, keymap.length() + 1);
+
+    return ro;
+}
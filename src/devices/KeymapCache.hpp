@@ -0,0 +1,53 @@
+#pragma once
+
+#include <future>
+#include <string>
+#include <unordered_map>
+#include <xkbcommon/xkbcommon.h>
+#include <hyprutils/os/FileDescriptor.hpp>
+#include "IKeyboard.hpp"
+
+/*
+    A compiled keymap, its serialized form and a read-only shm fd of that.
+    Never modified after it's built, keyboards share it and hand out duplicates of the fd.
+*/
+struct SCompiledKeymap {
+    ~SCompiledKeymap();
+
+    xkb_keymap*                    keymap = nullptr; // null if neither the file nor the rules compiled
+    std::string                    string;
+    Hyprutils::OS::CFileDescriptor fd;
+};
+
+/*
+    Process-wide keymap cache, keyed by rules, model, layout, variant, options and the kb_file contents.
+    All HID interfaces of a keyboard, virtual keyboards and reloads that don't touch the layout share
+    one compile. Compiles run on worker threads, each with its own xkb context; the cache and the fds
+    are main thread only.
+*/
+class CKeymapCache {
+  public:
+    // starts compiling in the background, no-op if it's cached or already compiling
+    static void prefetch(const IKeyboard::SStringRuleNames& rules, const std::string& filePath);
+    // prefetches what the device config resolves to, an empty name gives the input:kb_* defaults
+    static void prefetchForDevice(const std::string& deviceName);
+    // waits for a pending compile, compiles right away if nothing was prefetched
+    static SP<SCompiledKeymap> get(const IKeyboard::SStringRuleNames& rules, const std::string& filePath);
+    // drops keymaps no keyboard holds anymore
+    static void prune();
+    // a read-only shm fd with the keymap string, what wl_keyboard.keymap wants
+    static Hyprutils::OS::CFileDescriptor createKeymapFD(const std::string& keymap);
+
+  private:
+    struct SRequest {
+        std::string                 key;
+        IKeyboard::SStringRuleNames rules;
+        std::string                 fileContents;
+    };
+
+    static SRequest            makeRequest(const IKeyboard::SStringRuleNames& rules, const std::string& filePath);
+    static SP<SCompiledKeymap> compile(const SRequest& request);
+
+    // key -> compile, finished or still running
+    static inline std::unordered_map<std::string, std::shared_future<SP<SCompiledKeymap>>> m_keymaps;
+};
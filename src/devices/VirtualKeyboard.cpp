@@ -36,6 +36,7 @@ CVirtualKeyboard::CVirtualKeyboard(SP<CVirtualKeyboardV1Resource> keeb_) : m_key
             xkb_keymap_unref(m_xkbKeymap);
         m_xkbKeymap        = xkb_keymap_ref(E.keymap);
         m_keymapOverridden = true;
+        m_compiledKeymap.reset();
         updateXKBTranslationState(m_xkbKeymap);
         updateKeymapFD();
         m_keyboardEvents.keymap.emit(d);
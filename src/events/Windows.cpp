@@ -65,7 +65,6 @@ void Events::listener_mapWindow(void* owner, void* data) {
     }
     auto PWORKSPACE          = PMONITOR->m_activeSpecialWorkspace ? PMONITOR->m_activeSpecialWorkspace : PMONITOR->m_activeWorkspace;
     PWINDOW->m_monitor       = PMONITOR;
-    PWINDOW->m_workspace     = PWORKSPACE;
     PWINDOW->m_isMapped      = true;
     PWINDOW->m_readyToDelete = false;
     PWINDOW->m_fadingOut     = false;
@@ -73,6 +72,7 @@ void Events::listener_mapWindow(void* owner, void* data) {
     PWINDOW->m_firstMap      = true;
     PWINDOW->m_initialTitle  = PWINDOW->m_title;
     PWINDOW->m_initialClass  = PWINDOW->fetchClass();
+    PWINDOW->setWorkspace(PWORKSPACE);
 
     // check for token
     std::string requestedWorkspace = "";
@@ -90,7 +90,7 @@ void Events::listener_mapWindow(void* owner, void* data) {
 
                 Debug::log(LOG, "HL_INITIAL_WORKSPACE_TOKEN {} -> {}", SZTOKEN, WS.workspace);
 
-                if (g_pCompositor->getWorkspaceByString(WS.workspace) != PWINDOW->m_workspace) {
+                if (g_pCompositor->getWorkspaceByString(WS.workspace) != PWINDOW->workspace()) {
                     requestedWorkspace = WS.workspace;
                     workspaceSilent    = true;
                 }
@@ -172,8 +172,8 @@ void Events::listener_mapWindow(void* owner, void* data) {
                         g_pKeybindManager->m_dispatchers["focusmonitor"](std::to_string(PWINDOW->monitorID()));
                         PMONITOR = PMONITORFROMID;
                     }
-                    PWINDOW->m_workspace = PMONITOR->m_activeSpecialWorkspace ? PMONITOR->m_activeSpecialWorkspace : PMONITOR->m_activeWorkspace;
-                    PWORKSPACE           = PWINDOW->m_workspace;
+                    PWINDOW->setWorkspace(PMONITOR->m_activeSpecialWorkspace ? PMONITOR->m_activeSpecialWorkspace : PMONITOR->m_activeWorkspace);
+                    PWORKSPACE           = PWINDOW->workspace();
 
                     Debug::log(LOG, "Rule monitor, applying to {:mw}", PWINDOW);
                     requestedFSMonitor = MONITOR_INVALID;
@@ -353,7 +353,7 @@ void Events::listener_mapWindow(void* owner, void* data) {
 
             PWORKSPACE = pWorkspace;
 
-            PWINDOW->m_workspace = pWorkspace;
+            PWINDOW->setWorkspace(pWorkspace);
             PWINDOW->m_monitor   = pWorkspace->m_monitor;
 
             if (PWINDOW->m_monitor.lock()->m_activeSpecialWorkspace && !pWorkspace->m_isSpecialWorkspace)
@@ -385,8 +385,8 @@ void Events::listener_mapWindow(void* owner, void* data) {
             g_pKeybindManager->m_dispatchers["focusmonitor"](std::to_string(PWINDOW->monitorID()));
             PMONITOR = PMONITORFROMID;
         }
-        PWINDOW->m_workspace = PMONITOR->m_activeSpecialWorkspace ? PMONITOR->m_activeSpecialWorkspace : PMONITOR->m_activeWorkspace;
-        PWORKSPACE           = PWINDOW->m_workspace;
+        PWINDOW->setWorkspace(PMONITOR->m_activeSpecialWorkspace ? PMONITOR->m_activeSpecialWorkspace : PMONITOR->m_activeWorkspace);
+        PWORKSPACE           = PWINDOW->workspace();
 
         Debug::log(LOG, "Requested monitor, applying to {:mw}", PWINDOW);
     }
@@ -596,13 +596,13 @@ void Events::listener_mapWindow(void* owner, void* data) {
     if (PLSFROMFOCUS && PLSFROMFOCUS->m_layerSurface->current.interactivity != ZWLR_LAYER_SURFACE_V1_KEYBOARD_INTERACTIVITY_NONE)
         PWINDOW->m_noInitialFocus = true;
 
-    if (PWINDOW->m_workspace->m_hasFullscreenWindow && !requestedInternalFSMode.has_value() && !requestedClientFSMode.has_value() && !PWINDOW->m_isFloating) {
+    if (PWINDOW->workspace()->m_hasFullscreenWindow && !requestedInternalFSMode.has_value() && !requestedClientFSMode.has_value() && !PWINDOW->m_isFloating) {
         if (*PNEWTAKESOVERFS == 0)
             PWINDOW->m_noInitialFocus = true;
         else if (*PNEWTAKESOVERFS == 1)
-            requestedInternalFSMode = PWINDOW->m_workspace->m_fullscreenMode;
+            requestedInternalFSMode = PWINDOW->workspace()->m_fullscreenMode;
         else if (*PNEWTAKESOVERFS == 2)
-            g_pCompositor->setWindowFullscreenInternal(PWINDOW->m_workspace->getFullscreenWindow(), FSMODE_NONE);
+            g_pCompositor->setWindowFullscreenInternal(PWINDOW->workspace()->getFullscreenWindow(), FSMODE_NONE);
     }
 
     if (!PWINDOW->m_windowData.noFocus.valueOrDefault() && !PWINDOW->m_noInitialFocus &&
@@ -623,8 +623,8 @@ void Events::listener_mapWindow(void* owner, void* data) {
 
     if (!PWINDOW->m_noInitialFocus && (requestedInternalFSMode.has_value() || requestedClientFSMode.has_value() || requestedFSState.has_value())) {
         // fix fullscreen on requested (basically do a switcheroo)
-        if (PWINDOW->m_workspace->m_hasFullscreenWindow)
-            g_pCompositor->setWindowFullscreenInternal(PWINDOW->m_workspace->getFullscreenWindow(), FSMODE_NONE);
+        if (PWINDOW->workspace()->m_hasFullscreenWindow)
+            g_pCompositor->setWindowFullscreenInternal(PWINDOW->workspace()->getFullscreenWindow(), FSMODE_NONE);
 
         PWINDOW->m_realPosition->warp();
         PWINDOW->m_realSize->warp();
@@ -696,8 +696,8 @@ void Events::listener_mapWindow(void* owner, void* data) {
     // fix some xwayland apps that don't behave nicely
     PWINDOW->m_reportedSize = PWINDOW->m_pendingReportedSize;
 
-    if (PWINDOW->m_workspace)
-        PWINDOW->m_workspace->updateWindows();
+    if (PWINDOW->workspace())
+        PWINDOW->workspace()->updateWindows();
 
     if (PMONITOR && PWINDOW->isX11OverrideRedirect())
         PWINDOW->m_X11SurfaceScaledBy = PMONITOR->m_scale;
@@ -774,7 +774,7 @@ void Events::listener_unmapWindow(void* owner, void* data) {
         g_pKeybindManager->changeMouseBindMode(MBIND_INVALID);
 
     // remove the fullscreen window status from workspace if we closed it
-    const auto PWORKSPACE = PWINDOW->m_workspace;
+    const auto PWORKSPACE = PWINDOW->workspace();
 
     if (PWORKSPACE->m_hasFullscreenWindow && PWINDOW->isFullscreen())
         PWORKSPACE->m_hasFullscreenWindow = false;
@@ -803,7 +803,7 @@ void Events::listener_unmapWindow(void* owner, void* data) {
                 g_pCompositor->setWindowFullscreenInternal(PWINDOWCANDIDATE, CURRENTFSMODE);
         }
 
-        if (!PWINDOWCANDIDATE && PWINDOW->m_workspace && PWINDOW->m_workspace->getWindows() == 0)
+        if (!PWINDOWCANDIDATE && PWINDOW->workspace() && PWINDOW->workspace()->getWindows() == 0)
             g_pInputManager->refocus();
 
         g_pInputManager->sendMotionEventsToFocused();
@@ -833,8 +833,8 @@ void Events::listener_unmapWindow(void* owner, void* data) {
     g_pInputManager->recheckIdleInhibitorStatus();
 
     // force report all sizes (QT sometimes has an issue with this)
-    if (PWINDOW->m_workspace)
-        PWINDOW->m_workspace->forceReportSizesToWindows();
+    if (PWINDOW->workspace())
+        PWINDOW->workspace()->forceReportSizesToWindows();
 
     // update lastwindow after focus
     PWINDOW->onUnmap();
@@ -865,7 +865,7 @@ void Events::listener_commitWindow(void* owner, void* data) {
         g_pHyprRenderer->damageWindow(PWINDOW);
     }
 
-    if (!PWINDOW->m_workspace->m_visible)
+    if (!PWINDOW->workspace()->m_visible)
         return;
 
     const auto PMONITOR = PWINDOW->m_monitor.lock();
@@ -1006,7 +1006,7 @@ void Events::listener_unmanagedSetGeometry(void* owner, void* data) {
         PWINDOW->m_position = PWINDOW->m_realPosition->goal();
         PWINDOW->m_size     = PWINDOW->m_realSize->goal();
 
-        PWINDOW->m_workspace = g_pCompositor->getMonitorFromVector(PWINDOW->m_realPosition->value() + PWINDOW->m_realSize->value() / 2.f)->m_activeWorkspace;
+        PWINDOW->setWorkspace(g_pCompositor->getMonitorFromVector(PWINDOW->m_realPosition->value() + PWINDOW->m_realSize->value() / 2.f)->m_activeWorkspace);
 
         g_pCompositor->changeWindowZOrder(PWINDOW, true);
         PWINDOW->updateWindowDecos();
@@ -1,4 +1,5 @@
 #include "DamageRing.hpp"
+#include <algorithm>
 
 void CDamageRing::setSize(const Vector2D& size_) {
     if (size_ == m_size)
@@ -9,6 +10,19 @@ void CDamageRing::setSize(const Vector2D& size_) {
     damageEntire();
 }
 
+void CDamageRing::setBufferCount(int count) {
+    const size_t LEN = std::max(count, DAMAGE_RING_PREVIOUS_LEN);
+    if (LEN == m_previous.size())
+        return;
+
+    m_previous.clear();
+    m_previous.resize(LEN);
+    m_previousIdx   = 0;
+    m_validPrevious = 0;
+
+    damageEntire();
+}
+
 bool CDamageRing::damage(const CRegion& rg) {
     CRegion clipped = rg.copy().intersect(CBox{{}, m_size});
     if (clipped.empty())
@@ -23,30 +37,115 @@ void CDamageRing::damageEntire() {
 }
 
 void CDamageRing::rotate() {
-    m_previousIdx = (m_previousIdx + DAMAGE_RING_PREVIOUS_LEN - 1) % DAMAGE_RING_PREVIOUS_LEN;
+    const size_t LEN = m_previous.size();
+
+    m_previousIdx = (m_previousIdx + LEN - 1) % LEN;
 
     m_previous[m_previousIdx] = m_current;
     m_current.clear();
+
+    m_validPrevious = std::min(m_validPrevious + 1, LEN);
 }
 
 CRegion CDamageRing::getBufferDamage(int age) {
-    if (age <= 0 || age > DAMAGE_RING_PREVIOUS_LEN + 1)
+    // we don't have enough history for this buffer, its contents are unknown
+    if (age <= 0 || (size_t)age > m_validPrevious + 1)
         return CBox{{}, m_size};
 
     CRegion damage = m_current;
 
     for (int i = 0; i < age - 1; ++i) {
-        int j = (m_previousIdx + i) % DAMAGE_RING_PREVIOUS_LEN;
+        const size_t j = (m_previousIdx + i) % m_previous.size();
         damage.add(m_previous.at(j));
     }
 
-    // don't return a ludicrous amount of rects
-    if (damage.getRects().size() > 8)
-        return damage.getExtents();
-
-    return damage;
+    return simplifyDamage(damage);
 }
 
 bool CDamageRing::hasChanged() {
     return !m_current.empty();
 }
+
+struct SDamageBox {
+    int32_t x1 = 0, y1 = 0, x2 = 0, y2 = 0;
+
+    int64_t area() const {
+        return (int64_t)(x2 - x1) * (y2 - y1);
+    }
+
+    SDamageBox bound(const SDamageBox& other) const {
+        return {std::min(x1, other.x1), std::min(y1, other.y1), std::max(x2, other.x2), std::max(y2, other.y2)};
+    }
+};
+
+CRegion simplifyDamage(const CRegion& damage) {
+    const auto RECTS = damage.getRects();
+
+    if (RECTS.size() <= 1)
+        return damage;
+
+    if (RECTS.size() > DAMAGE_MAX_MERGE_RECTS)
+        return damage.getExtents();
+
+    std::vector<SDamageBox> boxes;
+    boxes.reserve(RECTS.size());
+
+    for (auto const& r : RECTS) {
+        boxes.emplace_back(SDamageBox{r.x1, r.y1, r.x2, r.y2});
+    }
+
+    // greedily merge neighbours for as long as the extra pixels repainted cost less than the rect we save.
+    // Pixman bands a region into lots of touching rects, those merge for free. Only the boxes closest
+    // in y are tried, rects far apart vertically would rarely be worth joining anyway.
+    bool merged = true;
+    for (int pass = 0; merged && pass < DAMAGE_MAX_MERGE_PASSES && boxes.size() > 1; ++pass) {
+        merged = false;
+
+        std::ranges::sort(boxes, [](const auto& a, const auto& b) { return a.y1 < b.y1 || (a.y1 == b.y1 && a.x1 < b.x1); });
+
+        std::vector<SDamageBox> kept;
+        kept.reserve(boxes.size());
+
+        for (auto const& box : boxes) {
+            bool absorbed = false;
+
+            for (size_t i = kept.size(); i > 0 && kept.size() - i < DAMAGE_MERGE_WINDOW; --i) {
+                auto&      other = kept[i - 1];
+                const auto BOUND = other.bound(box);
+
+                if (BOUND.area() - other.area() - box.area() >= DAMAGE_RECT_COST)
+                    continue;
+
+                other    = BOUND;
+                absorbed = true;
+                merged   = true;
+                break;
+            }
+
+            if (!absorbed)
+                kept.emplace_back(box);
+        }
+
+        boxes = std::move(kept);
+    }
+
+    int64_t mergedArea = 0;
+    for (auto const& b : boxes) {
+        mergedArea += b.area();
+    }
+
+    // if the extents are cheaper after all, just use them
+    const auto EXTENTS = damage.getExtents();
+    if ((int64_t)(EXTENTS.w * EXTENTS.h) + DAMAGE_RECT_COST <= mergedArea + DAMAGE_RECT_COST * (int64_t)boxes.size())
+        return EXTENTS;
+
+    if (boxes.size() == RECTS.size())
+        return damage;
+
+    CRegion result;
+    for (auto const& b : boxes) {
+        result.add(CBox{(double)b.x1, (double)b.y1, (double)(b.x2 - b.x1), (double)(b.y2 - b.y1)});
+    }
+
+    return result;
+}
@@ -1,13 +1,26 @@
 #pragma once
 
 #include "./math/Math.hpp"
-#include <array>
+#include <vector>
 
+// minimum amount of previous frames kept, enough for a double-buffered swapchain
 constexpr static int DAMAGE_RING_PREVIOUS_LEN = 2;
 
+// per-rect overhead expressed in pixels. Every rect means a scissor and a draw per pass element,
+// so two rects are only kept apart if joining them would repaint more than this many extra pixels.
+constexpr static int64_t DAMAGE_RECT_COST = 128 * 128;
+
+// merging sweeps the rects sorted by y and only tries the last few boxes it kept, see simplifyDamage.
+// A pass is O(n log n), so the cap only guards against pathological regions
+constexpr static size_t DAMAGE_MAX_MERGE_RECTS  = 1024;
+constexpr static size_t DAMAGE_MERGE_WINDOW     = 8;
+constexpr static int    DAMAGE_MAX_MERGE_PASSES = 4;
+
 class CDamageRing {
   public:
     void    setSize(const Vector2D& size_);
+    // follow the swapchain length, history is dropped (and the output fully damaged) when it changes
+    void    setBufferCount(int count);
     bool    damage(const CRegion& rg);
     void    damageEntire();
     void    rotate();
@@ -15,8 +28,12 @@ class CDamageRing {
     bool    hasChanged();
 
   private:
-    Vector2D                                      m_size;
-    CRegion                                       m_current;
-    std::array<CRegion, DAMAGE_RING_PREVIOUS_LEN> m_previous;
-    size_t                                        m_previousIdx = 0;
+    Vector2D             m_size;
+    CRegion              m_current;
+    std::vector<CRegion> m_previous      = std::vector<CRegion>(DAMAGE_RING_PREVIOUS_LEN);
+    size_t               m_previousIdx   = 0;
+    size_t               m_validPrevious = 0; // how many entries of m_previous hold actual history
 };
+
+// reduce the amount of rects in a region, merging neighbours when that's cheaper than drawing them separately
+CRegion simplifyDamage(const CRegion& damage);
@@ -509,17 +509,19 @@ std::string execAndGet(const char* cmd) {
     return proc.stdOut();
 }
 
-void logSystemInfo() {
+std::string getSystemInfoLog() {
     struct utsname unameInfo;
 
     uname(&unameInfo);
 
-    Debug::log(LOG, "System name: {}", std::string{unameInfo.sysname});
-    Debug::log(LOG, "Node name: {}", std::string{unameInfo.nodename});
-    Debug::log(LOG, "Release: {}", std::string{unameInfo.release});
-    Debug::log(LOG, "Version: {}", std::string{unameInfo.version});
+    std::string result;
 
-    Debug::log(NONE, "\n");
+    result += std::format("System name: {}\n", std::string{unameInfo.sysname});
+    result += std::format("Node name: {}\n", std::string{unameInfo.nodename});
+    result += std::format("Release: {}\n", std::string{unameInfo.release});
+    result += std::format("Version: {}\n", std::string{unameInfo.version});
+
+    result += "\n\n";
 
 #if defined(__DragonFly__) || defined(__FreeBSD__)
     const std::string GPUINFO = execAndGet("pciconf -lv | grep -F -A4 vga");
@@ -545,16 +547,17 @@ void logSystemInfo() {
 #else
     const std::string GPUINFO = execAndGet("lspci -vnn | grep -E '(VGA|Display|3D)'");
 #endif
-    Debug::log(LOG, "GPU information:\n{}\n", GPUINFO);
+    result += std::format("GPU information:\n{}\n\n", GPUINFO);
 
-    if (GPUINFO.contains("NVIDIA")) {
-        Debug::log(WARN, "Warning: you're using an NVIDIA GPU. Make sure you follow the instructions on the wiki if anything is amiss.\n");
-    }
+    if (GPUINFO.contains("NVIDIA"))
+        result += "Warning: you're using an NVIDIA GPU. Make sure you follow the instructions on the wiki if anything is amiss.\n\n";
 
     // log etc
-    Debug::log(LOG, "os-release:");
+    result += "os-release:\n";
 
-    Debug::log(NONE, "{}", NFsUtils::readFileAsString("/etc/os-release").value_or("error"));
+    result += NFsUtils::readFileAsString("/etc/os-release").value_or("error");
+
+    return result;
 }
 
 int64_t getPPIDof(int64_t pid) {
@@ -26,7 +26,7 @@ bool                                isDirection(const char&);
 SWorkspaceIDName                    getWorkspaceIDNameFromString(const std::string&);
 std::optional<std::string>          cleanCmdForWorkspace(const std::string&, std::string);
 float                               vecToRectDistanceSquared(const Vector2D& vec, const Vector2D& p1, const Vector2D& p2);
-void                                logSystemInfo();
+std::string                         getSystemInfoLog(); // collects the SYSTEM INFO block, safe off the main thread
 std::string                         execAndGet(const char*);
 int64_t                             getPPIDof(int64_t pid);
 std::expected<int64_t, std::string> configStringToInt(const std::string&);
@@ -19,6 +19,7 @@
 #include "../managers/eventLoop/EventLoopManager.hpp"
 #include "../protocols/core/Compositor.hpp"
 #include "../render/Renderer.hpp"
+#include "../render/FrameScheduler.hpp"
 #include "../managers/EventManager.hpp"
 #include "../managers/LayoutManager.hpp"
 #include "../managers/input/InputManager.hpp"
@@ -28,6 +29,8 @@
 #include <aquamarine/output/Output.hpp>
 #include "debug/Log.hpp"
 #include "debug/HyprNotificationOverlay.hpp"
+#include "debug/FrameTracer.hpp"
+#include "debug/FrameMetrics.hpp"
 #include <hyprutils/string/String.hpp>
 #include <hyprutils/utils/ScopeGuard.hpp>
 #include <cstring>
@@ -73,13 +76,23 @@ void CMonitor::onConnect(bool noRule) {
     m_listeners.presented = m_output->events.present.registerListener([this](std::any d) {
         auto      E = std::any_cast<Aquamarine::IOutput::SPresentEvent>(d);
 
+        if (g_pFrameTracer)
+            g_pFrameTracer->instant("present", TRACE_CATEGORY_OUTPUT, "monitor", m_id);
+
         timespec* ts = E.when;
         if (!ts) {
             timespec now;
             clock_gettime(CLOCK_MONOTONIC, &now);
             PROTO::presentation->onPresented(m_self.lock(), Time::fromTimespec(&now), E.refresh, E.seq, E.flags);
-        } else
+            g_pFrameMetrics->onPresent(m_self.lock(), Time::fromTimespec(&now));
+            if (m_frameScheduler)
+                m_frameScheduler->onPresented(Time::fromTimespec(&now));
+        } else {
             PROTO::presentation->onPresented(m_self.lock(), Time::fromTimespec(E.when), E.refresh, E.seq, E.flags);
+            g_pFrameMetrics->onPresent(m_self.lock(), Time::fromTimespec(E.when));
+            if (m_frameScheduler)
+                m_frameScheduler->onPresented(Time::fromTimespec(E.when));
+        }
     });
 
     m_listeners.destroy = m_output->events.destroy.registerListener([this](std::any d) {
@@ -258,7 +271,8 @@ void CMonitor::onConnect(bool noRule) {
     if (!found)
         g_pCompositor->setActiveMonitor(m_self.lock());
 
-    m_renderTimer = wl_event_loop_add_timer(g_pCompositor->m_wlEventLoop, ratHandler, this);
+    m_renderTimer    = wl_event_loop_add_timer(g_pCompositor->m_wlEventLoop, ratHandler, this);
+    m_frameScheduler = makeUnique<CFrameScheduler>(m_self.lock());
 
     g_pCompositor->scheduleFrameForMonitor(m_self.lock(), Aquamarine::IOutput::AQ_SCHEDULE_NEW_MONITOR);
 
@@ -278,6 +292,8 @@ void CMonitor::onDisconnect(bool destroy) {
             return;
         g_pEventManager->postEvent(SHyprIPCEvent{"monitorremoved", m_name});
         EMIT_HOOK_EVENT("monitorRemoved", m_self.lock());
+        if (g_pFrameMetrics)
+            g_pFrameMetrics->onMonitorRemoved(m_self.lock());
         g_pCompositor->arrangeMonitors();
     }};
 
@@ -286,6 +302,8 @@ void CMonitor::onDisconnect(bool destroy) {
         m_renderTimer = nullptr;
     }
 
+    m_frameScheduler.reset();
+
     if (!m_enabled || g_pCompositor->m_isShuttingDown)
         return;
 
@@ -1122,7 +1140,7 @@ void CMonitor::changeWorkspace(const PHLWORKSPACE& pWorkspace, bool internal, bo
 
         // move pinned windows
         for (auto const& w : g_pCompositor->m_windows) {
-            if (w->m_workspace == POLDWORKSPACE && w->m_pinned)
+            if (w->workspace() == POLDWORKSPACE && w->m_pinned)
                 w->moveToWorkspace(pWorkspace);
         }
 
@@ -1233,7 +1251,7 @@ void CMonitor::setSpecialWorkspace(const PHLWORKSPACE& pWorkspace) {
         pWorkspace->startAnim(true, true);
 
     for (auto const& w : g_pCompositor->m_windows) {
-        if (w->m_workspace == pWorkspace) {
+        if (w->workspace() == pWorkspace) {
             w->m_monitor = m_self;
             w->updateSurfaceScaleTransformDetails();
             w->setAnimationsToMove();
@@ -1440,6 +1458,8 @@ bool CMonitor::attemptDirectScanout() {
         return false;
     }
 
+    g_pFrameMetrics->onCommit(m_self.lock());
+
     if (m_lastScanout.expired()) {
         m_lastScanout = PCANDIDATE;
         Debug::log(LOG, "Entered a direct scanout to {:x}: \"{}\"", (uintptr_t)PCANDIDATE.get(), PCANDIDATE->m_title);
@@ -1463,8 +1483,12 @@ void CMonitor::debugLastPresentation(const std::string& message) {
                m_lastPresentationTimer.getMillis() > 0 ? 1000.0f / m_lastPresentationTimer.getMillis() : 0.0f);
 }
 
-void CMonitor::onMonitorFrame() {
-    if ((g_pCompositor->m_aqBackend->hasSession() && !g_pCompositor->m_aqBackend->session->active) || !g_pCompositor->m_sessionActive || g_pCompositor->m_unsafeState) {
+bool CMonitor::sessionCanRender() {
+    return !(g_pCompositor->m_aqBackend->hasSession() && !g_pCompositor->m_aqBackend->session->active) && g_pCompositor->m_sessionActive && !g_pCompositor->m_unsafeState;
+}
+
+bool CMonitor::prepareFrame() {
+    if (!sessionCanRender()) {
         Debug::log(WARN, "Attempted to render frame on inactive session!");
 
         if (g_pCompositor->m_unsafeState && std::ranges::any_of(g_pCompositor->m_monitors.begin(), g_pCompositor->m_monitors.end(), [&](auto& m) {
@@ -1474,10 +1498,20 @@ void CMonitor::onMonitorFrame() {
             g_pCompositor->leaveUnsafeState();
         }
 
-        return; // cannot draw on session inactive (different tty)
+        return false; // cannot draw on session inactive (different tty)
     }
 
     if (!m_enabled)
+        return false;
+
+    // motion held back by input:motion_coalescing resolves focus before the frame, not after
+    g_pInputManager->flushCoalescedMotion();
+
+    return true;
+}
+
+void CMonitor::onMonitorFrame() {
+    if (!prepareFrame())
         return;
 
     g_pHyprRenderer->recheckSolitaryForMonitor(m_self.lock());
@@ -1498,6 +1532,10 @@ void CMonitor::onMonitorFrame() {
 
     m_lastPresentationTimer.reset();
 
+    // predictive scheduling takes precedence over RAT, it falls through to it whenever it declines to defer
+    if (m_frameScheduler && !m_tearingState.nextRenderTorn && m_frameScheduler->onFrame())
+        return;
+
     if (*PENABLERAT && !m_tearingState.nextRenderTorn) {
         if (!m_ratsScheduled) {
             // render
@@ -1522,8 +1560,10 @@ void CMonitor::onMonitorFrame() {
             g_pHyprRenderer->renderMonitor(m_self.lock());
         else
             wl_event_source_timer_update(m_renderTimer, TIMETOSLEEP);
-    } else
+    } else if (m_tearingState.nextRenderTorn)
         g_pHyprRenderer->renderMonitor(m_self.lock());
+    else
+        g_pHyprRenderer->queueMonitorRender(m_self.lock());
 }
 
 void CMonitor::onCursorMovedOnMonitor() {
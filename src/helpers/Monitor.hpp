@@ -56,6 +56,7 @@ struct SMonitorRule {
 };
 
 class CMonitor;
+class CFrameScheduler;
 class CSyncTimeline;
 class CEGLSync;
 
@@ -132,6 +133,8 @@ class CMonitor {
     bool                        m_ratsScheduled = false;
     CTimer                      m_lastPresentationTimer;
 
+    UP<CFrameScheduler>         m_frameScheduler;
+
     bool                        m_isBeingLeased = false;
 
     SMonitorRule                m_activeMonitorRule;
@@ -204,6 +207,10 @@ class CMonitor {
 
     void                                debugLastPresentation(const std::string& message);
     void                                onMonitorFrame();
+    // checks every frame goes through before drawing, also for ones rendered later (frame scheduler, batched renders). False if it must not render
+    bool                                prepareFrame();
+    // false on another VT, with the session inactive or in the unsafe state
+    static bool                         sessionCanRender();
 
     bool                                m_enabled             = false;
     bool                                m_renderingInitPassed = false;
@@ -0,0 +1,123 @@
+#include "StartupTasks.hpp"
+#include "MiscFunctions.hpp"
+#include "../debug/Log.hpp"
+#include <algorithm>
+#include <format>
+
+#define chr std::chrono
+
+CStartupTasks::CStartupTasks() {
+    m_start = Time::steadyNow();
+}
+
+CStartupTasks::~CStartupTasks() {
+    waitAll();
+}
+
+void CStartupTasks::spawn(const std::string& name, std::function<void()> fn, const std::vector<std::string>& deps) {
+    std::vector<std::shared_future<void>> depFutures;
+    for (auto const& d : deps) {
+        const auto IT = std::ranges::find_if(m_tasks, [&d](const auto& t) { return t->name == d; });
+        if (IT != m_tasks.end())
+            depFutures.emplace_back((*IT)->done);
+    }
+
+    auto task    = makeShared<STask>();
+    task->name   = name;
+    task->queued = Time::steadyNow();
+
+    task->done = std::async(std::launch::async, [task, fn = std::move(fn), depFutures = std::move(depFutures)]() {
+                     for (auto const& d : depFutures) {
+                         d.wait();
+                     }
+
+                     task->started = Time::steadyNow();
+
+                     try {
+                         fn();
+                     } catch (std::exception& e) { Debug::log(ERR, "StartupTasks: task {} threw: {}", task->name, e.what()); }
+
+                     task->finished = Time::steadyNow();
+                 }).share();
+
+    m_tasks.emplace_back(task);
+}
+
+void CStartupTasks::wait(const std::string& name) {
+    const auto IT = std::ranges::find_if(m_tasks, [&name](const auto& t) { return t->name == name; });
+    if (IT == m_tasks.end())
+        return;
+
+    const auto BEGIN = Time::steadyNow();
+    (*IT)->done.wait();
+    (*IT)->waitedMs += chr::duration_cast<chr::microseconds>(Time::steadyNow() - BEGIN).count() / 1000.F;
+}
+
+void CStartupTasks::waitAll() {
+    for (auto const& t : m_tasks) {
+        t->done.wait();
+    }
+}
+
+void CStartupTasks::mark(const std::string& stage) {
+    if (std::ranges::any_of(m_stages, [&stage](const auto& s) { return s.first == stage; }))
+        return;
+
+    m_stages.emplace_back(stage, Time::steadyNow());
+}
+
+bool CStartupTasks::finished(const SP<STask>& task) const {
+    return task->done.wait_for(chr::seconds(0)) == std::future_status::ready;
+}
+
+float CStartupTasks::msSinceStart(const Time::steady_tp& tp) const {
+    return chr::duration_cast<chr::microseconds>(tp - m_start).count() / 1000.F;
+}
+
+std::string CStartupTasks::dump(bool json) {
+    std::string result;
+
+    if (json) {
+        result += "{\n    \"stages\": [";
+        for (auto const& [name, tp] : m_stages) {
+            result += std::format(R"#(
+        {{"name": "{}", "atMs": {:.3f}}},)#",
+                                  escapeJSONStrings(name), msSinceStart(tp));
+        }
+        if (result.back() == ',')
+            result.pop_back();
+
+        result += "\n    ],\n    \"tasks\": [";
+        for (auto const& t : m_tasks) {
+            const bool DONE = finished(t);
+            result += std::format(R"#(
+        {{"name": "{}", "finished": {}, "queuedMs": {:.3f}, "startedMs": {:.3f}, "finishedMs": {:.3f}, "waitedMs": {:.3f}}},)#",
+                                  escapeJSONStrings(t->name), DONE, msSinceStart(t->queued), DONE ? msSinceStart(t->started) : 0.F, DONE ? msSinceStart(t->finished) : 0.F,
+                                  t->waitedMs);
+        }
+        if (result.back() == ',')
+            result.pop_back();
+
+        result += "\n    ]\n}";
+        return result;
+    }
+
+    result += "stages (ms since start):\n";
+    for (auto const& [name, tp] : m_stages) {
+        result += std::format("\t{:>10.2f}  {}\n", msSinceStart(tp), name);
+    }
+
+    result += "\ntasks (ms since start):\n";
+    for (auto const& t : m_tasks) {
+        if (!finished(t)) {
+            result += std::format("\t{}: queued at {:.2f}, still running\n", t->name, msSinceStart(t->queued));
+            continue;
+        }
+
+        result += std::format("\t{}: queued at {:.2f}, ran {:.2f} -> {:.2f} ({:.2f}ms), main thread waited {:.2f}ms\n", t->name, msSinceStart(t->queued),
+                              msSinceStart(t->started), msSinceStart(t->finished), chr::duration_cast<chr::microseconds>(t->finished - t->started).count() / 1000.F,
+                              t->waitedMs);
+    }
+
+    return result;
+}
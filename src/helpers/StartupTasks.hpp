@@ -0,0 +1,49 @@
+#pragma once
+
+#include <functional>
+#include <future>
+#include <string>
+#include <vector>
+#include "memory/Memory.hpp"
+#include "time/Time.hpp"
+
+/*
+    Startup work that doesn't need the main thread (no GL, no wayland), run on worker threads while
+    the backend, GL and protocols come up. Tasks can depend on other tasks by name.
+
+    Also keeps a timeline of the main startup stages, for hyprctl startup.
+    Everything except the task bodies is main thread only.
+*/
+class CStartupTasks {
+  public:
+    CStartupTasks();
+    ~CStartupTasks();
+
+    // runs fn on a worker thread once all of deps finished. Unknown deps are ignored.
+    void        spawn(const std::string& name, std::function<void()> fn, const std::vector<std::string>& deps = {});
+    // blocks until the task finished, returns right away if it was never spawned
+    void        wait(const std::string& name);
+    void        waitAll();
+
+    // records a startup stage, the first mark of a given name wins
+    void        mark(const std::string& stage);
+
+    std::string dump(bool json);
+
+  private:
+    struct STask {
+        std::string              name;
+        std::shared_future<void> done;
+        Time::steady_tp          queued, started, finished; // written by the worker before done is ready
+        float                    waitedMs = 0;              // main thread time spent in wait()
+    };
+
+    bool                                                 finished(const SP<STask>& task) const;
+    float                                                msSinceStart(const Time::steady_tp& tp) const;
+
+    Time::steady_tp                                      m_start;
+    std::vector<SP<STask>>                               m_tasks;
+    std::vector<std::pair<std::string, Time::steady_tp>> m_stages;
+};
+
+inline UP<CStartupTasks> g_pStartupTasks;
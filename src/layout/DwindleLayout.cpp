@@ -254,7 +254,7 @@ void CHyprDwindleLayout::onWindowCreatedTiling(PHLWINDOW pWindow, eDirection dir
 
     } else if (*PUSEACTIVE) {
         if (g_pCompositor->m_lastWindow.lock() && !g_pCompositor->m_lastWindow->m_isFloating && g_pCompositor->m_lastWindow.lock() != pWindow &&
-            g_pCompositor->m_lastWindow->m_workspace == pWindow->m_workspace && g_pCompositor->m_lastWindow->m_isMapped) {
+            g_pCompositor->m_lastWindow->workspace() == pWindow->workspace() && g_pCompositor->m_lastWindow->m_isMapped) {
             OPENINGON = getNodeFromWindow(g_pCompositor->m_lastWindow.lock());
         } else {
             OPENINGON = getNodeFromWindow(g_pCompositor->vectorToWindowUnified(MOUSECOORDS, RESERVED_EXTENTS | INPUT_EXTENTS));
@@ -740,7 +740,7 @@ void CHyprDwindleLayout::resizeActiveWindow(const Vector2D& pixResize, eRectCorn
 
 void CHyprDwindleLayout::fullscreenRequestForWindow(PHLWINDOW pWindow, const eFullscreenMode CURRENT_EFFECTIVE_MODE, const eFullscreenMode EFFECTIVE_MODE) {
     const auto PMONITOR   = pWindow->m_monitor.lock();
-    const auto PWORKSPACE = pWindow->m_workspace;
+    const auto PWORKSPACE = pWindow->workspace();
 
     // save position and size if floating
     if (pWindow->m_isFloating && CURRENT_EFFECTIVE_MODE == FSMODE_NONE) {
@@ -891,7 +891,9 @@ void CHyprDwindleLayout::switchWindows(PHLWINDOW pWindow, PHLWINDOW pWindow2) {
 
     if (PNODE->workspaceID != PNODE2->workspaceID) {
         std::swap(pWindow2->m_monitor, pWindow->m_monitor);
-        std::swap(pWindow2->m_workspace, pWindow->m_workspace);
+        const auto PWORKSPACE2 = pWindow2->workspace();
+        pWindow2->setWorkspace(pWindow->workspace());
+        pWindow->setWorkspace(PWORKSPACE2);
     }
 
     pWindow->setAnimationsToMove();
@@ -1047,7 +1049,7 @@ void CHyprDwindleLayout::moveToRoot(PHLWINDOW pWindow, bool stable) {
         std::swap(pRoot->children[0], pRoot->children[1]);
 
     // if the workspace is visible, recalculate layout
-    if (pWindow->m_workspace && pWindow->m_workspace->isVisible())
+    if (pWindow->workspace() && pWindow->workspace()->isVisible())
         pRoot->recalcSizePosRecursive();
 }
 
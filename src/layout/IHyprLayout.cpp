@@ -195,9 +195,9 @@ void IHyprLayout::onWindowCreatedFloating(PHLWINDOW pWindow) {
 
 bool IHyprLayout::onWindowCreatedAutoGroup(PHLWINDOW pWindow) {
     static auto     PAUTOGROUP       = CConfigValue<Hyprlang::INT>("group:auto_group");
-    const PHLWINDOW OPENINGON        = g_pCompositor->m_lastWindow.lock() && g_pCompositor->m_lastWindow->m_workspace == pWindow->m_workspace ?
+    const PHLWINDOW OPENINGON        = g_pCompositor->m_lastWindow.lock() && g_pCompositor->m_lastWindow->workspace() == pWindow->workspace() ?
                g_pCompositor->m_lastWindow.lock() :
-               (pWindow->m_workspace ? pWindow->m_workspace->getFirstWindow() : nullptr);
+               (pWindow->workspace() ? pWindow->workspace()->getFirstWindow() : nullptr);
     const bool      FLOATEDINTOTILED = pWindow->m_isFloating && !OPENINGON->m_isFloating;
     const bool      SWALLOWING       = pWindow->m_swallowed || pWindow->m_groupSwallowed;
 
@@ -404,7 +404,7 @@ static void performSnap(Vector2D& sourcePos, Vector2D& sourceSize, PHLWINDOW DRA
     if (*SNAPWINDOWGAP) {
         const double GAPSIZE       = *SNAPWINDOWGAP;
         const auto   WSID          = DRAGGINGWINDOW->workspaceID();
-        const bool   HASFULLSCREEN = DRAGGINGWINDOW->m_workspace && DRAGGINGWINDOW->m_workspace->m_hasFullscreenWindow;
+        const bool   HASFULLSCREEN = DRAGGINGWINDOW->workspace() && DRAGGINGWINDOW->workspace()->m_hasFullscreenWindow;
 
         for (auto& other : g_pCompositor->m_windows) {
             if ((HASFULLSCREEN && !other->m_createdOverFullscreen) || other == DRAGGINGWINDOW || other->workspaceID() != WSID || !other->m_isMapped || other->m_fadingOut ||
@@ -809,7 +809,7 @@ PHLWINDOW IHyprLayout::getNextWindowCandidate(PHLWINDOW pWindow) {
     if (!pWindow)
         return nullptr;
 
-    const auto PWORKSPACE = pWindow->m_workspace;
+    const auto PWORKSPACE = pWindow->workspace();
 
     // first of all, if this is a fullscreen workspace,
     if (PWORKSPACE->m_hasFullscreenWindow)
@@ -819,7 +819,7 @@ PHLWINDOW IHyprLayout::getNextWindowCandidate(PHLWINDOW pWindow) {
 
         // find whether there is a floating window below this one
         for (auto const& w : g_pCompositor->m_windows) {
-            if (w->m_isMapped && !w->isHidden() && w->m_isFloating && !w->isX11OverrideRedirect() && w->m_workspace == pWindow->m_workspace && !w->m_X11ShouldntFocus &&
+            if (w->m_isMapped && !w->isHidden() && w->m_isFloating && !w->isX11OverrideRedirect() && w->workspace() == pWindow->workspace() && !w->m_X11ShouldntFocus &&
                 !w->m_windowData.noFocus.valueOrDefault() && w != pWindow) {
                 if (VECINRECT((pWindow->m_size / 2.f + pWindow->m_position), w->m_position.x, w->m_position.y, w->m_position.x + w->m_size.x, w->m_position.y + w->m_size.y)) {
                     return w;
@@ -828,7 +828,7 @@ PHLWINDOW IHyprLayout::getNextWindowCandidate(PHLWINDOW pWindow) {
         }
 
         // let's try the last tiled window.
-        if (m_lastTiledWindow.lock() && m_lastTiledWindow->m_workspace == pWindow->m_workspace)
+        if (m_lastTiledWindow.lock() && m_lastTiledWindow->workspace() == pWindow->workspace())
             return m_lastTiledWindow.lock();
 
         // if we don't, let's try to find any window that is in the middle
@@ -838,7 +838,7 @@ PHLWINDOW IHyprLayout::getNextWindowCandidate(PHLWINDOW pWindow) {
 
         // if not, floating window
         for (auto const& w : g_pCompositor->m_windows) {
-            if (w->m_isMapped && !w->isHidden() && w->m_isFloating && !w->isX11OverrideRedirect() && w->m_workspace == pWindow->m_workspace && !w->m_X11ShouldntFocus &&
+            if (w->m_isMapped && !w->isHidden() && w->m_isFloating && !w->isX11OverrideRedirect() && w->workspace() == pWindow->workspace() && !w->m_X11ShouldntFocus &&
                 !w->m_windowData.noFocus.valueOrDefault() && w != pWindow)
                 return w;
         }
@@ -951,7 +951,7 @@ bool IHyprLayout::updateDragWindow() {
             g_pCompositor->setWindowFullscreenInternal(DRAGGINGWINDOW, FSMODE_NONE);
         }
 
-        const auto PWORKSPACE = DRAGGINGWINDOW->m_workspace;
+        const auto PWORKSPACE = DRAGGINGWINDOW->workspace();
 
         if (PWORKSPACE->m_hasFullscreenWindow && (!DRAGGINGWINDOW->m_createdOverFullscreen || !DRAGGINGWINDOW->m_isFloating)) {
             Debug::log(LOG, "Rejecting drag on a fullscreen workspace. (window under fullscreen)");
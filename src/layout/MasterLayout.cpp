@@ -110,13 +110,13 @@ void CHyprMasterLayout::onWindowCreatedTiling(PHLWINDOW pWindow, eDirection dire
     static auto  PMFACT             = CConfigValue<Hyprlang::FLOAT>("master:mfact");
     float        lastSplitPercent   = *PMFACT;
 
-    auto         OPENINGON = isWindowTiled(g_pCompositor->m_lastWindow.lock()) && g_pCompositor->m_lastWindow->m_workspace == pWindow->m_workspace ?
+    auto         OPENINGON = isWindowTiled(g_pCompositor->m_lastWindow.lock()) && g_pCompositor->m_lastWindow->workspace() == pWindow->workspace() ?
                 getNodeFromWindow(g_pCompositor->m_lastWindow.lock()) :
                 getMasterNodeOnWorkspace(pWindow->workspaceID());
 
     const auto   MOUSECOORDS   = g_pInputManager->getMouseCoordsInternal();
     static auto  PDROPATCURSOR = CConfigValue<Hyprlang::INT>("master:drop_at_cursor");
-    eOrientation orientation   = getDynamicOrientation(pWindow->m_workspace);
+    eOrientation orientation   = getDynamicOrientation(pWindow->workspace());
     const auto   NODEIT        = std::find(m_masterNodesData.begin(), m_masterNodesData.end(), *PNODE);
 
     bool         forceDropAsMaster = false;
@@ -650,7 +650,7 @@ void CHyprMasterLayout::applyNodeDataToWindow(SMasterNodeData* pNode) {
     const auto PWINDOW = pNode->pWindow.lock();
     // get specific gaps and rules for this workspace,
     // if user specified them in config
-    const auto WORKSPACERULE = g_pConfigManager->getWorkspaceRuleFor(PWINDOW->m_workspace);
+    const auto WORKSPACERULE = g_pConfigManager->getWorkspaceRuleFor(PWINDOW->workspace());
 
     if (PWINDOW->isFullscreen() && !pNode->ignoreFullscreenChecks)
         return;
@@ -756,7 +756,7 @@ void CHyprMasterLayout::resizeActiveWindow(const Vector2D& pixResize, eRectCorne
     const auto   WINDOWS      = getNodesOnWorkspace(PNODE->workspaceID);
     const auto   STACKWINDOWS = WINDOWS - MASTERS;
 
-    eOrientation orientation = getDynamicOrientation(PWINDOW->m_workspace);
+    eOrientation orientation = getDynamicOrientation(PWINDOW->workspace());
     bool         centered    = orientation == ORIENTATION_CENTER && (STACKWINDOWS >= *SLAVECOUNTFORCENTER);
     double       delta       = 0;
 
@@ -869,7 +869,7 @@ void CHyprMasterLayout::resizeActiveWindow(const Vector2D& pixResize, eRectCorne
 
 void CHyprMasterLayout::fullscreenRequestForWindow(PHLWINDOW pWindow, const eFullscreenMode CURRENT_EFFECTIVE_MODE, const eFullscreenMode EFFECTIVE_MODE) {
     const auto PMONITOR   = pWindow->m_monitor.lock();
-    const auto PWORKSPACE = pWindow->m_workspace;
+    const auto PWORKSPACE = pWindow->workspace();
 
     // save position and size if floating
     if (pWindow->m_isFloating && CURRENT_EFFECTIVE_MODE == FSMODE_NONE) {
@@ -946,10 +946,10 @@ void CHyprMasterLayout::moveWindowTo(PHLWINDOW pWindow, const std::string& dir,
 
     pWindow->setAnimationsToMove();
 
-    if (pWindow->m_workspace != PWINDOW2->m_workspace) {
+    if (pWindow->workspace() != PWINDOW2->workspace()) {
         // if different monitors, send to monitor
         onWindowRemovedTiling(pWindow);
-        pWindow->moveToWorkspace(PWINDOW2->m_workspace);
+        pWindow->moveToWorkspace(PWINDOW2->workspace());
         pWindow->m_monitor = PWINDOW2->m_monitor;
         if (!silent) {
             const auto pMonitor = pWindow->m_monitor.lock();
@@ -984,7 +984,9 @@ void CHyprMasterLayout::switchWindows(PHLWINDOW pWindow, PHLWINDOW pWindow2) {
 
     if (PNODE->workspaceID != PNODE2->workspaceID) {
         std::swap(pWindow2->m_monitor, pWindow->m_monitor);
-        std::swap(pWindow2->m_workspace, pWindow->m_workspace);
+        const auto PWORKSPACE2 = pWindow2->workspace();
+        pWindow2->setWorkspace(pWindow->workspace());
+        pWindow->setWorkspace(PWORKSPACE2);
     }
 
     // massive hack: just swap window pointers, lol
@@ -1053,7 +1055,7 @@ std::any CHyprMasterLayout::layoutMessage(SLayoutMessageHeader header, std::stri
             return;
 
         if (header.pWindow->isFullscreen()) {
-            const auto  PWORKSPACE        = header.pWindow->m_workspace;
+            const auto  PWORKSPACE        = header.pWindow->workspace();
             const auto  FSMODE            = header.pWindow->m_fullscreenState.internal;
             static auto INHERITFULLSCREEN = CConfigValue<Hyprlang::INT>("master:inherit_fullscreen");
             g_pCompositor->setWindowFullscreenInternal(header.pWindow, FSMODE_NONE);
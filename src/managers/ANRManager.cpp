@@ -19,78 +19,112 @@ CANRManager::CANRManager() {
         return;
     }
 
-    m_timer = makeShared<CEventLoopTimer>(TIMER_TIMEOUT, [this](SP<CEventLoopTimer> self, void* data) { onTick(); }, this);
+    m_timer = makeShared<CEventLoopTimer>(std::nullopt, [this](SP<CEventLoopTimer> self, void* data) { onTick(); }, this);
     g_pEventLoopManager->addTimer(m_timer);
 
     m_active = true;
 
     static auto P = g_pHookSystem->hookDynamic("openWindow", [this](void* self, SCallbackInfo& info, std::any data) {
-        auto window = std::any_cast<PHLWINDOW>(data);
+        auto       window = std::any_cast<PHLWINDOW>(data);
+        const auto KEY    = keyFor(window);
 
-        for (const auto& d : m_data) {
-            if (d->fitsWindow(window))
-                return;
+        if (!KEY)
+            return;
+
+        auto client = dataFor(KEY);
+
+        if (!client) {
+            client = m_data.emplace(KEY, makeShared<SANRData>(window)).first->second;
+
+            if (m_deadlines.empty())
+                m_timer->updateTimeout(TIMER_TIMEOUT);
+
+            m_deadlines.emplace_back(SPingDeadline{.at = Time::steadyNow() + TIMER_TIMEOUT, .data = client});
         }
 
-        m_data.emplace_back(makeShared<SANRData>(window));
+        client->windows.emplace_back(window);
     });
 
-    m_timer->updateTimeout(TIMER_TIMEOUT);
+    static auto P2 = g_pHookSystem->hookDynamic("closeWindow", [this](void* self, SCallbackInfo& info, std::any data) { onWindowClosed(std::any_cast<PHLWINDOW>(data)); });
 }
 
 void CANRManager::onTick() {
-    static auto PENABLEANR    = CConfigValue<Hyprlang::INT>("misc:enable_anr_dialog");
-    static auto PANRTHRESHOLD = CConfigValue<Hyprlang::INT>("misc:anr_missed_pings");
+    static auto PENABLEANR = CConfigValue<Hyprlang::INT>("misc:enable_anr_dialog");
 
     if (!*PENABLEANR) {
         m_timer->updateTimeout(TIMER_TIMEOUT * 10);
         return;
     }
 
-    for (auto& data : m_data) {
-        PHLWINDOW firstWindow;
-        int       count = 0;
-        for (const auto& w : g_pCompositor->m_windows) {
-            if (!w->m_isMapped)
-                continue;
+    const auto NOW = Time::steadyNow();
 
-            if (!data->fitsWindow(w))
-                continue;
+    while (!m_deadlines.empty() && m_deadlines.front().at <= NOW) {
+        const auto CLIENT = m_deadlines.front().data.lock();
+        m_deadlines.pop_front();
 
-            count++;
-            if (!firstWindow)
-                firstWindow = w;
-        }
+        // gone with its last window, nothing left to ping
+        if (!CLIENT)
+            continue;
+
+        onTick(CLIENT);
 
-        if (count == 0)
+        // all its windows got unmapped without a close, or the client itself went away. Stop tracking it, openWindow starts over
+        if (CLIENT->windows.empty() || CLIENT->isDefunct()) {
+            std::erase_if(m_data, [&CLIENT](const auto& el) { return el.second == CLIENT; });
             continue;
+        }
+
+        m_deadlines.emplace_back(SPingDeadline{.at = NOW + TIMER_TIMEOUT, .data = CLIENT});
+    }
+
+    if (m_deadlines.empty()) {
+        m_timer->updateTimeout(std::nullopt);
+        return;
+    }
 
-        if (data->missedResponses >= *PANRTHRESHOLD) {
-            if (!data->isRunning() && !data->dialogSaidWait) {
-                data->runDialog("Application Not Responding", firstWindow->m_title, firstWindow->m_class, data->getPid());
+    m_timer->updateTimeout(std::max(m_deadlines.front().at - NOW, Time::steady_dur::zero()));
+}
 
-                for (const auto& w : g_pCompositor->m_windows) {
-                    if (!w->m_isMapped)
-                        continue;
+void CANRManager::onTick(SP<CANRManager::SANRData> data) {
+    static auto PANRTHRESHOLD = CConfigValue<Hyprlang::INT>("misc:anr_missed_pings");
 
-                    if (!data->fitsWindow(w))
-                        continue;
+    std::erase_if(data->windows, [](const auto& w) { return !w || !w->m_isMapped; });
 
-                    *w->m_notRespondingTint = 0.2F;
-                }
+    if (data->windows.empty())
+        return;
+
+    if (data->missedResponses >= *PANRTHRESHOLD) {
+        if (!data->isRunning() && !data->dialogSaidWait) {
+            const auto FIRSTWINDOW = data->windows.front().lock();
+            data->runDialog("Application Not Responding", FIRSTWINDOW->m_title, FIRSTWINDOW->m_class, data->getPid());
+
+            for (const auto& w : data->windows) {
+                *w->m_notRespondingTint = 0.2F;
             }
-        } else if (data->isRunning())
-            data->killDialog();
+        }
+    } else if (data->isRunning())
+        data->killDialog();
 
-        if (data->missedResponses == 0)
-            data->dialogSaidWait = false;
+    if (data->missedResponses == 0)
+        data->dialogSaidWait = false;
 
-        data->missedResponses++;
+    data->missedResponses++;
 
-        data->ping();
-    }
+    data->ping();
+}
+
+void CANRManager::onWindowClosed(PHLWINDOW pWindow) {
+    const auto KEY  = keyFor(pWindow);
+    const auto DATA = dataFor(KEY);
+
+    if (!DATA)
+        return;
 
-    m_timer->updateTimeout(TIMER_TIMEOUT);
+    std::erase_if(DATA->windows, [&pWindow](const auto& w) { return !w || pWindow == w; });
+
+    // drops the dialog with it, its deadline goes stale and is skipped
+    if (DATA->windows.empty())
+        m_data.erase(KEY);
 }
 
 void CANRManager::onResponse(SP<CXDGWMBase> wmBase) {
@@ -131,23 +165,41 @@ bool CANRManager::isNotResponding(SP<CANRManager::SANRData> data) {
     return data->missedResponses > *PANRTHRESHOLD;
 }
 
-SP<CANRManager::SANRData> CANRManager::dataFor(PHLWINDOW pWindow) {
-    auto it = m_data.end();
+const void* CANRManager::keyFor(PHLWINDOW pWindow) {
     if (pWindow->m_xwaylandSurface)
-        it = std::ranges::find_if(m_data, [&pWindow](const auto& data) { return data->xwaylandSurface && data->xwaylandSurface == pWindow->m_xwaylandSurface; });
+        return pWindow->m_xwaylandSurface.get();
     else if (pWindow->m_xdgSurface)
-        it = std::ranges::find_if(m_data, [&pWindow](const auto& data) { return data->xdgBase && data->xdgBase == pWindow->m_xdgSurface->owner; });
-    return it == m_data.end() ? nullptr : *it;
+        return pWindow->m_xdgSurface->owner.get();
+    return nullptr;
+}
+
+SP<CANRManager::SANRData> CANRManager::dataFor(const void* key) {
+    if (!key)
+        return nullptr;
+
+    const auto IT = m_data.find(key);
+    if (IT == m_data.end())
+        return nullptr;
+
+    // the address got reused by a new wm_base or surface, the old one's state is stale
+    if (IT->second->isDefunct()) {
+        m_data.erase(IT);
+        return nullptr;
+    }
+
+    return IT->second;
+}
+
+SP<CANRManager::SANRData> CANRManager::dataFor(PHLWINDOW pWindow) {
+    return dataFor(keyFor(pWindow));
 }
 
 SP<CANRManager::SANRData> CANRManager::dataFor(SP<CXDGWMBase> wmBase) {
-    auto it = std::ranges::find_if(m_data, [&wmBase](const auto& data) { return data->xdgBase && data->xdgBase == wmBase; });
-    return it == m_data.end() ? nullptr : *it;
+    return dataFor((const void*)wmBase.get());
 }
 
 SP<CANRManager::SANRData> CANRManager::dataFor(SP<CXWaylandSurface> pXwaylandSurface) {
-    auto it = std::ranges::find_if(m_data, [&pXwaylandSurface](const auto& data) { return data->xwaylandSurface && data->xwaylandSurface == pXwaylandSurface; });
-    return it == m_data.end() ? nullptr : *it;
+    return dataFor((const void*)pXwaylandSurface.get());
 }
 
 CANRManager::SANRData::SANRData(PHLWINDOW pWindow) : xwaylandSurface(pWindow->m_xwaylandSurface), xdgBase(pWindow->m_xdgSurface ? pWindow->m_xdgSurface->owner : WP<CXDGWMBase>{}) {
@@ -197,14 +249,6 @@ void CANRManager::SANRData::killDialog() {
     dialogBox = nullptr;
 }
 
-bool CANRManager::SANRData::fitsWindow(PHLWINDOW pWindow) const {
-    if (pWindow->m_xwaylandSurface)
-        return pWindow->m_xwaylandSurface == xwaylandSurface;
-    else if (pWindow->m_xdgSurface)
-        return pWindow->m_xdgSurface->owner == xdgBase && xdgBase;
-    return false;
-}
-
 bool CANRManager::SANRData::isDefunct() const {
     return xdgBase.expired() && xwaylandSurface.expired();
 }
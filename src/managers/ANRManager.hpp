@@ -8,6 +8,9 @@
 #include "./eventLoop/EventLoopTimer.hpp"
 #include "../helpers/signal/Signal.hpp"
 #include "../helpers/AsyncDialogBox.hpp"
+#include "../helpers/time/Time.hpp"
+#include <deque>
+#include <unordered_map>
 #include <vector>
 
 class CXDGWMBase;
@@ -27,34 +30,50 @@ class CANRManager {
 
     void                onTick();
 
+    /*
+        Ping state of one client: a wm_base for wayland clients, the surface for X ones as they all share Xwayland's connection.
+        Knows its own mapped windows, registered on openWindow and dropped on closeWindow, so nothing here walks the window list.
+    */
     struct SANRData {
         SANRData(PHLWINDOW pWindow);
         ~SANRData();
 
-        WP<CXWaylandSurface> xwaylandSurface;
-        WP<CXDGWMBase>       xdgBase;
+        WP<CXWaylandSurface>      xwaylandSurface;
+        WP<CXDGWMBase>            xdgBase;
+        std::vector<PHLWINDOWREF> windows;
 
-        int                  missedResponses = 0;
+        int                       missedResponses = 0;
 
-        bool                 dialogSaidWait = false;
-        SP<CAsyncDialogBox>  dialogBox;
+        bool                      dialogSaidWait = false;
+        SP<CAsyncDialogBox>       dialogBox;
 
-        void                 runDialog(const std::string& title, const std::string& appName, const std::string appClass, pid_t dialogWmPID);
-        bool                 isRunning();
-        void                 killDialog();
-        bool                 isDefunct() const;
-        bool                 fitsWindow(PHLWINDOW pWindow) const;
-        pid_t                getPid() const;
-        void                 ping();
+        void                      runDialog(const std::string& title, const std::string& appName, const std::string appClass, pid_t dialogWmPID);
+        bool                      isRunning();
+        void                      killDialog();
+        bool                      isDefunct() const;
+        pid_t                     getPid() const;
+        void                      ping();
     };
 
-    void                      onResponse(SP<SANRData> data);
-    bool                      isNotResponding(SP<SANRData> data);
-    SP<SANRData>              dataFor(PHLWINDOW pWindow);
-    SP<SANRData>              dataFor(SP<CXDGWMBase> wmBase);
-    SP<SANRData>              dataFor(SP<CXWaylandSurface> pXwaylandSurface);
+    struct SPingDeadline {
+        Time::steady_tp at;
+        WP<SANRData>    data;
+    };
+
+    void                                          onResponse(SP<SANRData> data);
+    bool                                          isNotResponding(SP<SANRData> data);
+    void                                          onTick(SP<SANRData> data);
+    void                                          onWindowClosed(PHLWINDOW pWindow);
+    SP<SANRData>                                  dataFor(PHLWINDOW pWindow);
+    SP<SANRData>                                  dataFor(SP<CXDGWMBase> wmBase);
+    SP<SANRData>                                  dataFor(SP<CXWaylandSurface> pXwaylandSurface);
+    SP<SANRData>                                  dataFor(const void* key);
+
+    static const void*                            keyFor(PHLWINDOW pWindow);
 
-    std::vector<SP<SANRData>> m_data;
+    std::unordered_map<const void*, SP<SANRData>> m_data; // wm_base or X surface -> its ping state
+    // every client is pinged at the same interval, so appending keeps this sorted by deadline and a round only touches due clients
+    std::deque<SPingDeadline> m_deadlines;
 };
 
 inline UP<CANRManager> g_pANRManager;
\ No newline at end of file
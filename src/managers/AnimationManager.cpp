@@ -109,8 +109,9 @@ static void handleUpdate(CAnimatedVariable<VarType>& av, bool warp) {
             g_pHyprRenderer->damageMonitor(PMONITOR);
 
         // TODO: just make this into a damn callback already vax...
-        for (auto const& w : g_pCompositor->m_windows) {
-            if (!w->m_isMapped || w->isHidden() || w->m_workspace != PWORKSPACE)
+        for (auto const& ref : PWORKSPACE->windows()) {
+            const auto w = ref.lock();
+            if (!w || !w->m_isMapped || w->isHidden())
                 continue;
 
             if (w->m_isFloating && !w->m_pinned) {
@@ -127,8 +128,9 @@ static void handleUpdate(CAnimatedVariable<VarType>& av, bool warp) {
         }
 
         // damage any workspace window that is on any monitor
-        for (auto const& w : g_pCompositor->m_windows) {
-            if (!validMapped(w) || w->m_workspace != PWORKSPACE || w->m_pinned)
+        for (auto const& ref : PWORKSPACE->windows()) {
+            const auto w = ref.lock();
+            if (!validMapped(w) || w->m_pinned)
                 continue;
 
             g_pHyprRenderer->damageWindow(w);
@@ -163,8 +165,11 @@ static void handleUpdate(CAnimatedVariable<VarType>& av, bool warp) {
                 PWINDOW->updateWindowDecos();
                 g_pHyprRenderer->damageWindow(PWINDOW);
             } else if (PWORKSPACE) {
-                for (auto const& w : g_pCompositor->m_windows) {
-                    if (!validMapped(w) || w->m_workspace != PWORKSPACE)
+                const auto WINDOWS = PWORKSPACE->windows();
+
+                for (auto const& ref : WINDOWS) {
+                    const auto w = ref.lock();
+                    if (!validMapped(w) || w->workspace() != PWORKSPACE)
                         continue;
 
                     w->updateWindowDecos();
@@ -5,6 +5,11 @@
 #include "../xwayland/XWayland.hpp"
 #include "../managers/HookSystemManager.hpp"
 #include "../helpers/Monitor.hpp"
+#include "../helpers/StartupTasks.hpp"
+#include "../render/Texture.hpp"
+
+// shapes kept baked at once, apps rarely cycle through more than a handful
+constexpr size_t CURSOR_CACHE_MAX_SHAPES = 32;
 
 static int cursorAnimTimer(SP<CEventLoopTimer> self, void* data) {
     const auto cursorMgr = reinterpret_cast<CCursorManager*>(data);
@@ -68,8 +73,29 @@ void CCursorBuffer::endDataPtr() {
     ;
 }
 
+SP<CTexture> CCursorBuffer::texture() {
+    if (!m_texture)
+        m_texture = makeShared<CTexture>(DRM_FORMAT_ARGB8888, m_data.data(), m_stride, size, true);
+
+    return m_texture;
+}
+
+// the default theme, loaded by the startup task
+static UP<Hyprcursor::CHyprcursorManager> preloadedHyprcursor;
+
+void CCursorManager::preloadTheme() {
+    preloadedHyprcursor = makeUnique<Hyprcursor::CHyprcursorManager>(nullptr, hcLogger);
+}
+
 CCursorManager::CCursorManager() {
-    m_hyprcursor               = makeUnique<Hyprcursor::CHyprcursorManager>(m_theme.empty() ? nullptr : m_theme.c_str(), hcLogger);
+    if (g_pStartupTasks)
+        g_pStartupTasks->wait("cursor theme");
+
+    if (preloadedHyprcursor && m_theme.empty())
+        m_hyprcursor = std::move(preloadedHyprcursor);
+    else
+        m_hyprcursor = makeUnique<Hyprcursor::CHyprcursorManager>(m_theme.empty() ? nullptr : m_theme.c_str(), hcLogger);
+
     m_xcursor                  = makeUnique<CXCursorManager>();
     static auto PUSEHYPRCURSOR = CConfigValue<Hyprlang::INT>("cursor:enable_hyprcursor");
 
@@ -125,7 +151,7 @@ CCursorManager::~CCursorManager() {
 }
 
 SP<Aquamarine::IBuffer> CCursorManager::getCursorBuffer() {
-    return !m_cursorBuffers.empty() ? m_cursorBuffers.back() : nullptr;
+    return m_cursorBuffer;
 }
 
 void CCursorManager::setCursorSurface(SP<CWLSurface> surf, const Vector2D& hotspot) {
@@ -138,10 +164,9 @@ void CCursorManager::setCursorSurface(SP<CWLSurface> surf, const Vector2D& hotsp
 }
 
 void CCursorManager::setCursorBuffer(SP<CCursorBuffer> buf, const Vector2D& hotspot, const float& scale) {
-    m_cursorBuffers.emplace_back(buf);
-    g_pPointerManager->setCursorBuffer(getCursorBuffer(), hotspot, scale);
-    if (m_cursorBuffers.size() > 1)
-        std::erase_if(m_cursorBuffers, [this](const auto& buf) { return buf.get() == m_cursorBuffers.front().get(); });
+    // the previous buffer stays alive until the pointer manager let go of it
+    g_pPointerManager->setCursorBuffer(buf, hotspot, scale);
+    m_cursorBuffer = buf;
 
     m_ourBufferConnected = true;
 }
@@ -158,104 +183,134 @@ void CCursorManager::setAnimationTimer(const int& frame, const int& delay) {
     m_currentAnimationFrame = frame;
 }
 
-void CCursorManager::setCursorFromName(const std::string& name) {
+SP<CCursorManager::SCursorShape> CCursorManager::bakeHyprcursorShape(const std::string& name) {
+    auto shapeData = m_hyprcursor->getShape(name.c_str(), m_currentStyleInfo);
 
-    static auto PUSEHYPRCURSOR = CConfigValue<Hyprlang::INT>("cursor:enable_hyprcursor");
+    if (shapeData.images.size() < 1) {
+        // try with '_' first (old hc, etc)
+        std::string newName = name;
+        std::replace(newName.begin(), newName.end(), '-', '_');
 
-    auto        setXCursor = [this](auto const& name) {
-        float scale = std::ceil(m_cursorScale);
+        shapeData = m_hyprcursor->getShape(newName.c_str(), m_currentStyleInfo);
+    }
 
-        auto  xcursor = m_xcursor->getShape(name, m_size, m_cursorScale);
-        auto& icon    = xcursor->images.front();
-        auto  buf     = makeShared<CCursorBuffer>((uint8_t*)icon.pixels.data(), icon.size, icon.hotspot);
-        setCursorBuffer(buf, icon.hotspot / scale, scale);
+    if (shapeData.images.size() < 1) {
+        // fallback to a default if available
+        constexpr const std::array<const char*, 3> fallbackShapes = {"default", "left_ptr", "left-ptr"};
 
-        m_currentXcursor = xcursor;
+        for (auto const& s : fallbackShapes) {
+            shapeData = m_hyprcursor->getShape(s, m_currentStyleInfo);
 
-        int delay = 0;
-        int frame = 0;
-        if (m_currentXcursor->images.size() > 1)
-            delay = m_currentXcursor->images[frame].delay;
+            if (shapeData.images.size() > 0)
+                break;
+        }
 
-        setAnimationTimer(frame, delay);
-    };
+        if (shapeData.images.size() < 1) {
+            Debug::log(ERR, "BUG THIS: No fallback found for a cursor in setCursorFromName");
+            return nullptr;
+        }
+    }
 
-    auto setHyprCursor = [this](auto const& name) {
-        m_currentCursorShapeData = m_hyprcursor->getShape(name.c_str(), m_currentStyleInfo);
+    auto shape        = makeShared<SCursorShape>();
+    shape->name       = name;
+    shape->hyprcursor = true;
+    shape->scale      = m_cursorScale;
+    shape->frames.reserve(shapeData.images.size());
+
+    for (auto const& image : shapeData.images) {
+        const Vector2D HOTSPOT = {image.hotspotX, image.hotspotY};
+        shape->frames.emplace_back(SCursorFrame{
+            .buffer  = makeShared<CCursorBuffer>(image.surface, Vector2D{image.size, image.size}, HOTSPOT),
+            .hotspot = HOTSPOT / m_cursorScale,
+            .delay   = image.delay,
+        });
+    }
 
-        if (m_currentCursorShapeData.images.size() < 1) {
-            // try with '_' first (old hc, etc)
-            std::string newName = name;
-            std::replace(newName.begin(), newName.end(), '-', '_');
+    return shape;
+}
 
-            m_currentCursorShapeData = m_hyprcursor->getShape(newName.c_str(), m_currentStyleInfo);
-        }
+SP<CCursorManager::SCursorShape> CCursorManager::bakeXCursorShape(const std::string& name) {
+    const float SCALE   = std::ceil(m_cursorScale);
+    const auto  XCURSOR = m_xcursor->getShape(name, m_size, m_cursorScale);
+
+    if (!XCURSOR || XCURSOR->images.empty())
+        return nullptr;
+
+    auto shape        = makeShared<SCursorShape>();
+    shape->name       = name;
+    shape->hyprcursor = false;
+    shape->scale      = SCALE;
+    shape->frames.reserve(XCURSOR->images.size());
+
+    for (auto const& icon : XCURSOR->images) {
+        shape->frames.emplace_back(SCursorFrame{
+            .buffer  = makeShared<CCursorBuffer>((uint8_t*)icon.pixels.data(), icon.size, icon.hotspot),
+            .hotspot = icon.hotspot / SCALE,
+            .delay   = (int)icon.delay,
+        });
+    }
 
-        if (m_currentCursorShapeData.images.size() < 1) {
-            // fallback to a default if available
-            constexpr const std::array<const char*, 3> fallbackShapes = {"default", "left_ptr", "left-ptr"};
+    return shape;
+}
 
-            for (auto const& s : fallbackShapes) {
-                m_currentCursorShapeData = m_hyprcursor->getShape(s, m_currentStyleInfo);
+SP<CCursorManager::SCursorShape> CCursorManager::cachedShape(const std::string& name, bool hyprcursor) {
+    const auto IT = m_shapeCache.find(name);
+    if (IT != m_shapeCache.end() && IT->second->hyprcursor == hyprcursor) {
+        IT->second->lastUsed = ++m_cacheClock;
+        return IT->second;
+    }
 
-                if (m_currentCursorShapeData.images.size() > 0)
-                    break;
-            }
+    auto shape = hyprcursor ? bakeHyprcursorShape(name) : bakeXCursorShape(name);
+    if (!shape)
+        return nullptr;
 
-            if (m_currentCursorShapeData.images.size() < 1) {
-                Debug::log(ERR, "BUG THIS: No fallback found for a cursor in setCursorFromName");
-                return false;
-            }
-        }
+    shape->lastUsed    = ++m_cacheClock;
+    m_shapeCache[name] = shape;
+
+    if (m_shapeCache.size() > CURSOR_CACHE_MAX_SHAPES) {
+        const auto OLDEST = std::ranges::min_element(m_shapeCache, [](const auto& a, const auto& b) { return a.second->lastUsed < b.second->lastUsed; });
+        m_shapeCache.erase(OLDEST);
+    }
+
+    return shape;
+}
+
+void CCursorManager::invalidateCache() {
+    // m_currentShape stays alive until the next shape is set, so an animation in progress doesn't lose its frames
+    m_shapeCache.clear();
+}
+
+void CCursorManager::setCursorFrame(int frame) {
+    const auto& FRAME = m_currentShape->frames.at(frame);
 
-        auto buf = makeShared<CCursorBuffer>(m_currentCursorShapeData.images[0].surface, Vector2D{m_currentCursorShapeData.images[0].size, m_currentCursorShapeData.images[0].size},
-                                             Vector2D{m_currentCursorShapeData.images[0].hotspotX, m_currentCursorShapeData.images[0].hotspotY});
-        auto hotspot = Vector2D{m_currentCursorShapeData.images[0].hotspotX, m_currentCursorShapeData.images[0].hotspotY} / m_cursorScale;
-        setCursorBuffer(buf, hotspot, m_cursorScale);
+    setCursorBuffer(FRAME.buffer, FRAME.hotspot, m_currentShape->scale);
 
-        int delay = 0;
-        int frame = 0;
-        if (m_currentCursorShapeData.images.size() > 1)
-            delay = m_currentCursorShapeData.images[frame].delay;
+    setAnimationTimer(frame, m_currentShape->frames.size() > 1 ? FRAME.delay : 0);
+}
+
+void CCursorManager::setCursorFromName(const std::string& name) {
+    static auto PUSEHYPRCURSOR = CConfigValue<Hyprlang::INT>("cursor:enable_hyprcursor");
+
+    SP<SCursorShape> shape;
 
-        setAnimationTimer(frame, delay);
-        return true;
-    };
+    if (m_hyprcursor->valid() && *PUSEHYPRCURSOR)
+        shape = cachedShape(name, true);
 
-    if (!m_hyprcursor->valid() || !*PUSEHYPRCURSOR || !setHyprCursor(name))
-        setXCursor(name);
+    if (!shape)
+        shape = cachedShape(name, false);
+
+    if (!shape)
+        return;
+
+    m_currentShape = shape;
+    setCursorFrame(0);
 }
 
 void CCursorManager::tickAnimatedCursor() {
-    if (!m_ourBufferConnected)
+    if (!m_ourBufferConnected || !m_currentShape || m_currentShape->frames.size() < 2)
         return;
 
-    if (!m_hyprcursor->valid() && m_currentXcursor->images.size() > 1) {
-        m_currentAnimationFrame++;
-
-        if ((size_t)m_currentAnimationFrame >= m_currentXcursor->images.size())
-            m_currentAnimationFrame = 0;
-
-        float scale = std::ceil(m_cursorScale);
-        auto& icon  = m_currentXcursor->images.at(m_currentAnimationFrame);
-        auto  buf   = makeShared<CCursorBuffer>((uint8_t*)icon.pixels.data(), icon.size, icon.hotspot);
-        setCursorBuffer(buf, icon.hotspot / scale, scale);
-        setAnimationTimer(m_currentAnimationFrame, m_currentXcursor->images[m_currentAnimationFrame].delay);
-    } else if (m_currentCursorShapeData.images.size() > 1) {
-        m_currentAnimationFrame++;
-
-        if ((size_t)m_currentAnimationFrame >= m_currentCursorShapeData.images.size())
-            m_currentAnimationFrame = 0;
-
-        auto hotspot =
-            Vector2D{m_currentCursorShapeData.images[m_currentAnimationFrame].hotspotX, m_currentCursorShapeData.images[m_currentAnimationFrame].hotspotY} / m_cursorScale;
-        auto buf = makeShared<CCursorBuffer>(
-            m_currentCursorShapeData.images[m_currentAnimationFrame].surface,
-            Vector2D{m_currentCursorShapeData.images[m_currentAnimationFrame].size, m_currentCursorShapeData.images[m_currentAnimationFrame].size},
-            Vector2D{m_currentCursorShapeData.images[m_currentAnimationFrame].hotspotX, m_currentCursorShapeData.images[m_currentAnimationFrame].hotspotY});
-        setCursorBuffer(buf, hotspot, m_cursorScale);
-        setAnimationTimer(m_currentAnimationFrame, m_currentCursorShapeData.images[m_currentAnimationFrame].delay);
-    }
+    setCursorFrame((m_currentAnimationFrame + 1) % m_currentShape->frames.size());
 }
 
 SCursorImageData CCursorManager::dataFor(const std::string& name) {
@@ -296,6 +351,8 @@ void CCursorManager::updateTheme() {
 
     m_cursorScale = highestScale;
 
+    invalidateCache();
+
     if (*PUSEHYPRCURSOR) {
         if (m_currentStyleInfo.size > 0 && m_hyprcursor->valid())
             m_hyprcursor->cursorSurfaceStyleDone(m_currentStyleInfo);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <unordered_map>
 #include <hyprcursor/hyprcursor.hpp>
 #include "../includes.hpp"
 #include "../helpers/math/Math.hpp"
@@ -11,6 +12,7 @@
 #include <aquamarine/buffer/Buffer.hpp>
 
 class CWLSurface;
+class CTexture;
 
 AQUAMARINE_FORWARD(IBuffer);
 
@@ -29,10 +31,14 @@ class CCursorBuffer : public Aquamarine::IBuffer {
     virtual std::tuple<uint8_t*, uint32_t, size_t> beginDataPtr(uint32_t flags);
     virtual void                                   endDataPtr();
 
+    // uploaded on first use and kept with the buffer, so cached cursors aren't re-uploaded
+    SP<CTexture>                                   texture();
+
   private:
     Vector2D             m_hotspot;
     std::vector<uint8_t> m_data;
     size_t               m_stride = 0;
+    SP<CTexture>         m_texture;
 };
 
 class CCursorManager {
@@ -55,23 +61,49 @@ class CCursorManager {
 
     void                    tickAnimatedCursor();
 
-  private:
-    bool                               m_ourBufferConnected = false;
-    std::vector<SP<CCursorBuffer>>     m_cursorBuffers;
-
-    UP<Hyprcursor::CHyprcursorManager> m_hyprcursor;
-    UP<CXCursorManager>                m_xcursor;
-    SP<SXCursors>                      m_currentXcursor;
+    // loads the default hyprcursor theme, off the main thread during startup
+    static void             preloadTheme();
 
-    std::string                        m_theme       = "";
-    int                                m_size        = 0;
-    float                              m_cursorScale = 1.0;
-
-    Hyprcursor::SCursorStyleInfo       m_currentStyleInfo;
-
-    SP<CEventLoopTimer>                m_animationTimer;
-    int                                m_currentAnimationFrame = 0;
-    Hyprcursor::SCursorShapeData       m_currentCursorShapeData;
+  private:
+    struct SCursorFrame {
+        SP<CCursorBuffer> buffer;
+        Vector2D          hotspot; // logical
+        int               delay = 0;
+    };
+
+    // a shape with all of its frames baked into buffers for the current theme and scale
+    struct SCursorShape {
+        std::string               name;
+        bool                      hyprcursor = false;
+        float                     scale      = 1.F; // buffer scale
+        std::vector<SCursorFrame> frames;
+        uint64_t                  lastUsed = 0;
+    };
+
+    SP<SCursorShape>                                  cachedShape(const std::string& name, bool hyprcursor);
+    SP<SCursorShape>                                  bakeHyprcursorShape(const std::string& name);
+    SP<SCursorShape>                                  bakeXCursorShape(const std::string& name);
+    void                                              invalidateCache();
+    void                                              setCursorFrame(int frame);
+
+    bool                                              m_ourBufferConnected = false;
+    SP<CCursorBuffer>                                 m_cursorBuffer;
+
+    UP<Hyprcursor::CHyprcursorManager>                m_hyprcursor;
+    UP<CXCursorManager>                               m_xcursor;
+
+    std::string                                       m_theme       = "";
+    int                                               m_size        = 0;
+    float                                             m_cursorScale = 1.0;
+
+    Hyprcursor::SCursorStyleInfo                      m_currentStyleInfo;
+
+    SP<CEventLoopTimer>                               m_animationTimer;
+    int                                               m_currentAnimationFrame = 0;
+
+    std::unordered_map<std::string, SP<SCursorShape>> m_shapeCache;
+    SP<SCursorShape>                                  m_currentShape;
+    uint64_t                                          m_cacheClock = 0;
 };
 
 inline UP<CCursorManager> g_pCursorManager;
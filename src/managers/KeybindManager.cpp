@@ -1,5 +1,6 @@
 #include "../config/ConfigValue.hpp"
 #include "../devices/IKeyboard.hpp"
+#include "../devices/KeymapCache.hpp"
 #include "../managers/SeatManager.hpp"
 #include "../protocols/LayerShell.hpp"
 #include "../protocols/ShortcutsInhibit.hpp"
@@ -286,30 +287,20 @@ void CKeybindManager::updateXKBTranslationState() {
     const std::string VARIANT  = std::string{*PVARIANT} == STRVAL_EMPTY ? "" : *PVARIANT;
     const std::string OPTIONS  = std::string{*POPTIONS} == STRVAL_EMPTY ? "" : *POPTIONS;
 
-    xkb_rule_names    rules      = {.rules = RULES.c_str(), .model = MODEL.c_str(), .layout = LAYOUT.c_str(), .variant = VARIANT.c_str(), .options = OPTIONS.c_str()};
-    const auto        PCONTEXT   = xkb_context_new(XKB_CONTEXT_NO_FLAGS);
-    FILE* const       KEYMAPFILE = FILEPATH == "" ? nullptr : fopen(absolutePath(FILEPATH, g_pConfigManager->m_configCurrentPath).c_str(), "r");
+    auto              keymap = CKeymapCache::get(IKeyboard::SStringRuleNames{.layout = LAYOUT, .model = MODEL, .variant = VARIANT, .options = OPTIONS, .rules = RULES}, FILEPATH);
 
-    auto              PKEYMAP = KEYMAPFILE ? xkb_keymap_new_from_file(PCONTEXT, KEYMAPFILE, XKB_KEYMAP_FORMAT_TEXT_V1, XKB_KEYMAP_COMPILE_NO_FLAGS) :
-                                             xkb_keymap_new_from_names(PCONTEXT, &rules, XKB_KEYMAP_COMPILE_NO_FLAGS);
-    if (KEYMAPFILE)
-        fclose(KEYMAPFILE);
-
-    if (!PKEYMAP) {
+    if (!keymap->keymap) {
         g_pHyprError->queueCreate("[Runtime Error] Invalid keyboard layout passed. ( rules: " + RULES + ", model: " + MODEL + ", variant: " + VARIANT + ", options: " + OPTIONS +
                                       ", layout: " + LAYOUT + " )",
                                   CHyprColor(1.0, 50.0 / 255.0, 50.0 / 255.0, 1.0));
 
-        Debug::log(ERR, "[XKBTranslationState] Keyboard layout {} with variant {} (rules: {}, model: {}, options: {}) couldn't have been loaded.", rules.layout, rules.variant,
-                   rules.rules, rules.model, rules.options);
-        memset(&rules, 0, sizeof(rules));
+        Debug::log(ERR, "[XKBTranslationState] Keyboard layout {} with variant {} (rules: {}, model: {}, options: {}) couldn't have been loaded.", LAYOUT, VARIANT, RULES,
+                   MODEL, OPTIONS);
 
-        PKEYMAP = xkb_keymap_new_from_names(PCONTEXT, &rules, XKB_KEYMAP_COMPILE_NO_FLAGS);
+        keymap = CKeymapCache::get({}, "");
     }
 
-    xkb_context_unref(PCONTEXT);
-    m_xkbTranslationState = xkb_state_new(PKEYMAP);
-    xkb_keymap_unref(PKEYMAP);
+    m_xkbTranslationState = keymap->keymap ? xkb_state_new(keymap->keymap) : nullptr;
 }
 
 bool CKeybindManager::ensureMouseBindState() {
@@ -389,8 +380,8 @@ void CKeybindManager::switchToWindow(PHLWINDOW PWINDOWTOCHANGETO, bool preserveF
     // remove constraints
     g_pInputManager->unconstrainMouse();
 
-    if (PLASTWINDOW && PLASTWINDOW->m_workspace == PWINDOWTOCHANGETO->m_workspace && PLASTWINDOW->isFullscreen()) {
-        const auto PWORKSPACE = PLASTWINDOW->m_workspace;
+    if (PLASTWINDOW && PLASTWINDOW->workspace() == PWINDOWTOCHANGETO->workspace() && PLASTWINDOW->isFullscreen()) {
+        const auto PWORKSPACE = PLASTWINDOW->workspace();
         const auto MODE       = PWORKSPACE->m_fullscreenMode;
 
         if (!PWINDOWTOCHANGETO->m_pinned)
@@ -1163,9 +1154,9 @@ static SDispatchResult toggleActiveFloatingCore(std::string args, std::optional<
         g_pLayoutManager->getCurrentLayout()->changeWindowFloatingMode(PWINDOW);
     }
 
-    if (PWINDOW->m_workspace) {
-        PWINDOW->m_workspace->updateWindows();
-        PWINDOW->m_workspace->updateWindowData();
+    if (PWINDOW->workspace()) {
+        PWINDOW->workspace()->updateWindows();
+        PWINDOW->workspace()->updateWindowData();
     }
 
     g_pLayoutManager->getCurrentLayout()->recalculateMonitor(PWINDOW->monitorID());
@@ -1422,7 +1413,7 @@ SDispatchResult CKeybindManager::moveActiveToWorkspace(std::string args) {
 
     auto        pWorkspace            = g_pCompositor->getWorkspaceByID(WORKSPACEID);
     PHLMONITOR  pMonitor              = nullptr;
-    const auto  POLDWS                = PWINDOW->m_workspace;
+    const auto  POLDWS                = PWINDOW->workspace();
     static auto PALLOWWORKSPACECYCLES = CConfigValue<Hyprlang::INT>("binds:allow_workspace_cycles");
 
     updateRelativeCursorCoords();
@@ -1786,7 +1777,7 @@ SDispatchResult CKeybindManager::toggleSplit(std::string args) {
     if (!header.pWindow)
         return {.success = false, .error = "Window not found"};
 
-    const auto PWORKSPACE = header.pWindow->m_workspace;
+    const auto PWORKSPACE = header.pWindow->workspace();
 
     if (PWORKSPACE->m_hasFullscreenWindow)
         return {.success = false, .error = "Can't split windows that already split"};
@@ -1803,7 +1794,7 @@ SDispatchResult CKeybindManager::swapSplit(std::string args) {
     if (!header.pWindow)
         return {.success = false, .error = "Window not found"};
 
-    const auto PWORKSPACE = header.pWindow->m_workspace;
+    const auto PWORKSPACE = header.pWindow->workspace();
 
     if (PWORKSPACE->m_hasFullscreenWindow)
         return {.success = false, .error = "Can't split windows that already split"};
@@ -1929,7 +1920,7 @@ SDispatchResult CKeybindManager::workspaceOpt(std::string args) {
 
         // apply
         for (auto const& w : g_pCompositor->m_windows) {
-            if (!w->m_isMapped || w->m_workspace != PWORKSPACE)
+            if (!w->m_isMapped || w->workspace() != PWORKSPACE)
                 continue;
 
             w->m_isPseudotiled = PWORKSPACE->m_defaultPseudo;
@@ -1942,7 +1933,7 @@ SDispatchResult CKeybindManager::workspaceOpt(std::string args) {
         std::vector<PHLWINDOW> ptrs(g_pCompositor->m_windows.begin(), g_pCompositor->m_windows.end());
 
         for (auto const& w : ptrs) {
-            if (!w->m_isMapped || w->m_workspace != PWORKSPACE || w->isHidden())
+            if (!w->m_isMapped || w->workspace() != PWORKSPACE || w->isHidden())
                 continue;
 
             if (!w->m_requestsFloat && w->m_isFloating != PWORKSPACE->m_defaultFloating) {
@@ -2311,7 +2302,7 @@ SDispatchResult CKeybindManager::focusWindow(std::string regexp) {
 
     Debug::log(LOG, "Focusing to window name: {}", PWINDOW->m_title);
 
-    const auto PWORKSPACE = PWINDOW->m_workspace;
+    const auto PWORKSPACE = PWINDOW->workspace();
     if (!PWORKSPACE) {
         Debug::log(ERR, "BUG THIS: null workspace in focusWindow");
         return {.success = false, .error = "BUG THIS: null workspace in focusWindow"};
@@ -2319,8 +2310,8 @@ SDispatchResult CKeybindManager::focusWindow(std::string regexp) {
 
     updateRelativeCursorCoords();
 
-    if (g_pCompositor->m_lastMonitor && g_pCompositor->m_lastMonitor->m_activeWorkspace != PWINDOW->m_workspace &&
-        g_pCompositor->m_lastMonitor->m_activeSpecialWorkspace != PWINDOW->m_workspace) {
+    if (g_pCompositor->m_lastMonitor && g_pCompositor->m_lastMonitor->m_activeWorkspace != PWINDOW->workspace() &&
+        g_pCompositor->m_lastMonitor->m_activeSpecialWorkspace != PWINDOW->workspace()) {
         Debug::log(LOG, "Fake executing workspace to move focus");
         changeworkspace(PWORKSPACE->getConfigName());
     }
@@ -2710,7 +2701,7 @@ SDispatchResult CKeybindManager::swapnext(std::string arg) {
     const auto PLASTWINDOW = g_pCompositor->m_lastWindow.lock();
 
     const auto PLASTCYCLED =
-        validMapped(g_pCompositor->m_lastWindow->m_lastCycledWindow) && g_pCompositor->m_lastWindow->m_lastCycledWindow->m_workspace == PLASTWINDOW->m_workspace ?
+        validMapped(g_pCompositor->m_lastWindow->m_lastCycledWindow) && g_pCompositor->m_lastWindow->m_lastCycledWindow->workspace() == PLASTWINDOW->workspace() ?
         g_pCompositor->m_lastWindow->m_lastCycledWindow.lock() :
         nullptr;
 
@@ -2774,12 +2765,12 @@ SDispatchResult CKeybindManager::pinActive(std::string args) {
         return {.success = false, .error = "pin: window not found"};
     }
 
-    PWINDOW->m_workspace = PMONITOR->m_activeWorkspace;
+    PWINDOW->setWorkspace(PMONITOR->m_activeWorkspace);
 
     PWINDOW->updateDynamicRules();
     g_pCompositor->updateWindowAnimatedDecorationValues(PWINDOW);
 
-    const auto PWORKSPACE = PWINDOW->m_workspace;
+    const auto PWORKSPACE = PWINDOW->workspace();
 
     PWORKSPACE->m_lastFocusedWindow = g_pCompositor->vectorToWindowUnified(g_pInputManager->getMouseCoordsInternal(), RESERVED_EXTENTS | INPUT_EXTENTS);
 
@@ -2921,7 +2912,7 @@ void CKeybindManager::moveWindowIntoGroup(PHLWINDOW pWindow, PHLWINDOW pWindowIn
     g_pLayoutManager->getCurrentLayout()->onWindowRemoved(pWindow); // This removes groupped property!
 
     if (pWindow->m_monitor != pWindowInDirection->m_monitor) {
-        pWindow->moveToWorkspace(pWindowInDirection->m_workspace);
+        pWindow->moveToWorkspace(pWindowInDirection->workspace());
         pWindow->m_monitor = pWindowInDirection->m_monitor;
     }
 
@@ -15,6 +15,7 @@
 #include "../render/Renderer.hpp"
 #include "../render/OpenGL.hpp"
 #include "SeatManager.hpp"
+#include "CursorManager.hpp"
 #include "../helpers/time/Time.hpp"
 #include <cstring>
 #include <gbm.h>
@@ -440,15 +441,28 @@ SP<Aquamarine::IBuffer> CPointerManager::renderHWCursorBuffer(SP<CPointerManager
         if (shouldUseCpuBuffer)
             options.format = DRM_FORMAT_ARGB8888;
 
+        state->lastRendered = {};
+
         if (!state->monitor->m_cursorSwapchain->reconfigure(options)) {
             Debug::log(TRACE, "Failed to reconfigure cursor swapchain");
             return nullptr;
         }
     }
 
+    // same image as the one rendered last (re-entering the output, a shape set again without a different one in between),
+    // the buffer still holds it. Only the last image is remembered, A -> B -> A renders A again: swapchain buffers get recycled
+    // and can't be kept around per shape
+    if (m_currentCursorImage.pBuffer && state->lastRendered.buffer && state->lastRendered.texture.lock() == texture && state->lastRendered.scale == state->monitor->m_scale &&
+        state->lastRendered.transform == state->monitor->m_transform) {
+        Debug::log(TRACE, "[pointer] hw cursor image unchanged, reusing the last rendered buffer");
+        return state->lastRendered.buffer;
+    }
+
     // if we already rendered the cursor, revert the swapchain to avoid rendering the cursor over
     // the current front buffer
     // this flag will be reset in the preRender hook, so when we commit this buffer to KMS
+    state->lastRendered = {};
+
     if (state->cursorRendered)
         state->monitor->m_cursorSwapchain->rollback();
 
@@ -560,6 +574,8 @@ SP<Aquamarine::IBuffer> CPointerManager::renderHWCursorBuffer(SP<CPointerManager
 
         buf->endDataPtr();
 
+        state->lastRendered = {buf, texture, state->monitor->m_scale, state->monitor->m_transform};
+
         return buf;
     }
 
@@ -589,6 +605,8 @@ SP<Aquamarine::IBuffer> CPointerManager::renderHWCursorBuffer(SP<CPointerManager
 
     g_pHyprRenderer->onRenderbufferDestroy(RBO.get());
 
+    state->lastRendered = {buf, texture, state->monitor->m_scale, state->monitor->m_transform};
+
     return buf;
 }
 
@@ -625,7 +643,7 @@ void CPointerManager::renderSoftwareCursorsFor(PHLMONITOR pMonitor, const Time::
     data.tex = texture;
     data.box = box.round();
 
-    g_pHyprRenderer->m_sRenderPass.add(makeShared<CTexPassElement>(data));
+    g_pHyprRenderer->m_sRenderPass.emplace<CTexPassElement>(data);
 
     if (m_currentCursorImage.surface)
         m_currentCursorImage.surface->resource()->frame(now);
@@ -873,8 +891,13 @@ SP<CTexture> CPointerManager::getCurrentCursorTexture() {
         return nullptr;
 
     if (m_currentCursorImage.pBuffer) {
-        if (!m_currentCursorImage.bufferTex)
-            m_currentCursorImage.bufferTex = makeShared<CTexture>(m_currentCursorImage.pBuffer, true);
+        if (!m_currentCursorImage.bufferTex) {
+            // our own cursor buffers are cached by the cursor manager, reuse their upload
+            if (const auto CURSORBUF = dynamic_cast<CCursorBuffer*>(m_currentCursorImage.pBuffer.get()); CURSORBUF)
+                m_currentCursorImage.bufferTex = CURSORBUF->texture();
+            else
+                m_currentCursorImage.bufferTex = makeShared<CTexture>(m_currentCursorImage.pBuffer, true);
+        }
         return m_currentCursorImage.bufferTex;
     }
 
@@ -942,7 +965,8 @@ void CPointerManager::attachPointer(SP<IPointer> pointer) {
             shouldSkip = PMONITOR && PMONITOR->shouldSkipScheduleFrameOnMouseEvent();
         }
         g_pSeatManager->m_isPointerFrameSkipped = shouldSkip;
-        if (!g_pSeatManager->m_isPointerFrameSkipped)
+        // with motion_coalescing, the frame goes out with the held back motion
+        if (!g_pSeatManager->m_isPointerFrameSkipped && !g_pInputManager->hasCoalescedMotion())
             g_pSeatManager->sendPointerFrame();
     });
 
@@ -976,6 +1000,8 @@ void CPointerManager::attachPointer(SP<IPointer> pointer) {
     listener->pinchBegin = pointer->m_pointerEvents.pinchBegin.registerListener([] (std::any e) {
         auto E = std::any_cast<IPointer::SPinchBeginEvent>(e);
 
+        g_pInputManager->flushCoalescedMotion();
+
         PROTO::pointerGestures->pinchBegin(E.timeMs, E.fingers);
 
         PROTO::idle->onActivity();
@@ -1003,6 +1029,8 @@ void CPointerManager::attachPointer(SP<IPointer> pointer) {
     listener->holdBegin = pointer->m_pointerEvents.holdBegin.registerListener([] (std::any e) {
         auto E = std::any_cast<IPointer::SHoldBeginEvent>(e);
 
+        g_pInputManager->flushCoalescedMotion();
+
         PROTO::pointerGestures->holdBegin(E.timeMs, E.fingers);
 
         PROTO::idle->onActivity();
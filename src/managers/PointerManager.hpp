@@ -172,6 +172,14 @@ class CPointerManager {
         bool                    cursorRendered = false;
 
         SP<Aquamarine::IBuffer> cursorFrontBuffer;
+
+        // what the cursor swapchain last got rendered with, to skip re-rendering an unchanged image
+        struct {
+            SP<Aquamarine::IBuffer> buffer;
+            WP<CTexture>            texture;
+            float                   scale     = 1.F;
+            wl_output_transform     transform = WL_OUTPUT_TRANSFORM_NORMAL;
+        } lastRendered;
     };
 
     std::vector<SP<SMonitorPointerState>> m_monitorStates;
@@ -0,0 +1,241 @@
+#include "SelectionCacheManager.hpp"
+#include "SeatManager.hpp"
+#include "eventLoop/EventLoopManager.hpp"
+#include "../Compositor.hpp"
+#include "../config/ConfigValue.hpp"
+#include "../helpers/MiscFunctions.hpp"
+#include "../protocols/types/DataDevice.hpp"
+#include <hyprutils/string/VarList.hpp>
+#include <algorithm>
+#include <fcntl.h>
+#include <sys/sendfile.h>
+#include <unistd.h>
+using namespace Hyprutils::OS;
+using namespace Hyprutils::String;
+
+constexpr size_t PREFETCH_READ_SIZE = 64 * 1024;
+
+CSelectionCacheManager::SEntry::~SEntry() {
+    if (readSource)
+        wl_event_source_remove(readSource);
+}
+
+CSelectionCacheManager::SServe::~SServe() {
+    if (writeSource)
+        wl_event_source_remove(writeSource);
+}
+
+CSelectionCacheManager::CSelectionCacheManager() {
+    m_listeners.setSelection = g_pSeatManager->m_events.setSelection.registerListener([this](std::any d) { onSelection(m_clipboard, g_pSeatManager->m_selection.currentSelection); });
+    m_listeners.setPrimarySelection =
+        g_pSeatManager->m_events.setPrimarySelection.registerListener([this](std::any d) { onSelection(m_primary, g_pSeatManager->m_selection.currentPrimarySelection); });
+
+    m_ageTimer = makeShared<CEventLoopTimer>(std::nullopt, [this](SP<CEventLoopTimer> self, void* data) { evict(); }, nullptr);
+    g_pEventLoopManager->addTimer(m_ageTimer);
+}
+
+CSelectionCacheManager::~CSelectionCacheManager() {
+    if (g_pEventLoopManager)
+        g_pEventLoopManager->removeTimer(m_ageTimer);
+}
+
+void CSelectionCacheManager::onSelection(SSelection& selection, SP<IDataSource> source) {
+    static auto PENABLED = CConfigValue<Hyprlang::INT>("misc:selection_cache");
+    static auto PMIMES   = CConfigValue<Hyprlang::STRING>("misc:selection_cache_mimes");
+
+    selection.entries.clear();
+    selection.source = source;
+    selection.since  = Time::steadyNow();
+
+    if (!*PENABLED || !source)
+        return;
+
+    const auto OFFERED = source->mimes();
+
+    for (auto const& mime : CVarList(*PMIMES, 0, ',')) {
+        if (std::ranges::find(OFFERED, mime) == OFFERED.end())
+            continue;
+
+        int p[2];
+        if (pipe(p) == -1) {
+            Debug::log(ERR, "[selection cache] pipe() failed");
+            break;
+        }
+
+        fcntl(p[0], F_SETFD, FD_CLOEXEC);
+        fcntl(p[0], F_SETFL, O_NONBLOCK);
+        fcntl(p[1], F_SETFD, FD_CLOEXEC);
+
+        auto& entry       = selection.entries.emplace_back(makeShared<SEntry>());
+        entry->mime       = mime;
+        entry->readFD     = CFileDescriptor{p[0]};
+        entry->readSource = wl_event_loop_add_fd(
+            g_pCompositor->m_wlEventLoop, p[0], WL_EVENT_READABLE,
+            [](int fd, uint32_t mask, void* data) {
+                g_pSelectionCacheManager->onReadable((SEntry*)data);
+                return 0;
+            },
+            entry.get());
+
+        Debug::log(LOG, "[selection cache] prefetching {} from source {:x}", mime, (uintptr_t)source.get());
+
+        source->send(mime, CFileDescriptor{p[1]});
+    }
+
+    evict();
+}
+
+void CSelectionCacheManager::onReadable(SEntry* entry) {
+    static auto  PMAXSIZE = CConfigValue<Hyprlang::INT>("misc:selection_cache_max_size");
+    const size_t MAXSIZE  = *PMAXSIZE * 1024;
+
+    const size_t PRE = entry->buffer.size();
+    entry->buffer.resize(PRE + PREFETCH_READ_SIZE);
+
+    const auto LEN = read(entry->readFD.get(), entry->buffer.data() + PRE, PREFETCH_READ_SIZE);
+    entry->buffer.resize(PRE + std::max<ssize_t>(LEN, 0));
+
+    if (LEN < 0 && (errno == EAGAIN || errno == EINTR))
+        return;
+
+    // a source that fails or sends more than the whole cache may hold is left to serve that mime itself
+    if (LEN < 0 || entry->buffer.size() > MAXSIZE) {
+        Debug::log(LOG, "[selection cache] not caching {}: {}", entry->mime, LEN < 0 ? "read failed" : "over misc:selection_cache_max_size");
+        dropEntry(entry);
+        return;
+    }
+
+    if (LEN > 0)
+        return;
+
+    wl_event_source_remove(entry->readSource);
+    entry->readSource = nullptr;
+    entry->readFD.reset();
+
+    auto memfd = allocateSHMFile(entry->buffer.size());
+    if (!memfd.isValid() || write(memfd.get(), entry->buffer.data(), entry->buffer.size()) != (ssize_t)entry->buffer.size()) {
+        Debug::log(ERR, "[selection cache] failed to fill a memfd for {}", entry->mime);
+        dropEntry(entry);
+        return;
+    }
+
+    Debug::log(LOG, "[selection cache] cached {} bytes of {}", entry->buffer.size(), entry->mime);
+
+    entry->memfd = std::move(memfd);
+    entry->size  = entry->buffer.size();
+    entry->buffer.clear();
+    entry->buffer.shrink_to_fit();
+
+    // may drop this very entry, nothing can touch it after
+    evict();
+}
+
+void CSelectionCacheManager::send(SP<IDataSource> source, const std::string& mime, CFileDescriptor fd) {
+    static auto PENABLED = CConfigValue<Hyprlang::INT>("misc:selection_cache");
+
+    for (auto* sel : {&m_clipboard, &m_primary}) {
+        if (!*PENABLED || sel->source.lock() != source)
+            continue;
+
+        // not cached or still prefetching, ask the source like we always did
+        const auto IT = std::ranges::find_if(sel->entries, [&mime](const auto& e) { return e->mime == mime && e->memfd.isValid(); });
+        if (IT == sel->entries.end())
+            break;
+
+        Debug::log(LOG, "[selection cache] serving {} bytes of {} from the cache", (*IT)->size, mime);
+
+        fcntl(fd.get(), F_SETFL, O_WRONLY | O_NONBLOCK);
+
+        auto& serve = m_serving.emplace_back(makeUnique<SServe>());
+        serve->entry = *IT;
+        serve->fd    = std::move(fd);
+
+        if (!writeOut(serve.get()))
+            m_serving.pop_back();
+
+        return;
+    }
+
+    source->send(mime, std::move(fd));
+}
+
+bool CSelectionCacheManager::writeOut(SServe* serve) {
+    while ((size_t)serve->offset < serve->entry->size) {
+        const auto LEN = sendfile(serve->fd.get(), serve->entry->memfd.get(), &serve->offset, serve->entry->size - serve->offset);
+
+        if (LEN > 0 || (LEN < 0 && errno == EINTR))
+            continue;
+
+        if (LEN < 0 && errno == EAGAIN) {
+            // reader's pipe is full, carry on when it drained some
+            if (!serve->writeSource)
+                serve->writeSource = wl_event_loop_add_fd(
+                    g_pCompositor->m_wlEventLoop, serve->fd.get(), WL_EVENT_WRITABLE,
+                    [](int fd, uint32_t mask, void* data) {
+                        g_pSelectionCacheManager->onWritable((SServe*)data);
+                        return 0;
+                    },
+                    serve);
+            return true;
+        }
+
+        Debug::log(ERR, "[selection cache] sendfile died, reader got {} of {} bytes", serve->offset, serve->entry->size);
+        return false;
+    }
+
+    return false;
+}
+
+void CSelectionCacheManager::onWritable(SServe* serve) {
+    if (!writeOut(serve))
+        std::erase_if(m_serving, [serve](const auto& s) { return s.get() == serve; });
+}
+
+void CSelectionCacheManager::dropEntry(SEntry* entry) {
+    for (auto* sel : {&m_clipboard, &m_primary}) {
+        std::erase_if(sel->entries, [entry](const auto& e) { return e.get() == entry; });
+    }
+}
+
+size_t CSelectionCacheManager::cachedSize() {
+    size_t size = 0;
+    for (auto* sel : {&m_clipboard, &m_primary}) {
+        for (auto const& e : sel->entries) {
+            size += e->size + e->buffer.size();
+        }
+    }
+    return size;
+}
+
+void CSelectionCacheManager::evict() {
+    static auto  PMAXSIZE = CConfigValue<Hyprlang::INT>("misc:selection_cache_max_size");
+    static auto  PMAXAGE  = CConfigValue<Hyprlang::INT>("misc:selection_cache_max_age");
+    const size_t MAXSIZE  = *PMAXSIZE * 1024;
+    const auto   MAXAGE   = std::chrono::seconds(*PMAXAGE);
+    const auto   NOW      = Time::steadyNow();
+
+    if (*PMAXAGE > 0) {
+        for (auto* sel : {&m_clipboard, &m_primary}) {
+            if (NOW - sel->since >= MAXAGE)
+                sel->entries.clear();
+        }
+    }
+
+    // over the cap, the older selection goes first, the last mimes of each before the preferred ones
+    auto* older = m_clipboard.since < m_primary.since ? &m_clipboard : &m_primary;
+    for (auto* sel : {older, older == &m_clipboard ? &m_primary : &m_clipboard}) {
+        while (!sel->entries.empty() && cachedSize() > MAXSIZE) {
+            sel->entries.pop_back();
+        }
+    }
+
+    std::optional<Time::steady_dur> next;
+    if (*PMAXAGE > 0) {
+        for (auto* sel : {&m_clipboard, &m_primary}) {
+            if (!sel->entries.empty())
+                next = std::min(next.value_or(MAXAGE), sel->since + MAXAGE - NOW);
+        }
+    }
+
+    m_ageTimer->updateTimeout(next);
+}
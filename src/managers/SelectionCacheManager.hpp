@@ -0,0 +1,74 @@
+#pragma once
+
+#include "../helpers/memory/Memory.hpp"
+#include "../helpers/signal/Signal.hpp"
+#include "../helpers/time/Time.hpp"
+#include "./eventLoop/EventLoopTimer.hpp"
+#include <hyprutils/os/FileDescriptor.hpp>
+#include <string>
+#include <vector>
+
+class IDataSource;
+struct wl_event_source;
+
+/*
+    Opt-in (misc:selection_cache) compositor-side copy of the clipboard and primary selection.
+    When a selection is set, the misc:selection_cache_mimes it offers are read from the source
+    right away into memfds, receives of those are then served from there without a round-trip
+    to the source. Anything else still goes to the source. Entries go away with their selection,
+    after misc:selection_cache_max_age and, oldest selection first, past misc:selection_cache_max_size.
+*/
+class CSelectionCacheManager {
+  public:
+    CSelectionCacheManager();
+    ~CSelectionCacheManager();
+
+    // what offers call on receive instead of source->send
+    void send(SP<IDataSource> source, const std::string& mime, Hyprutils::OS::CFileDescriptor fd);
+
+  private:
+    struct SEntry {
+        ~SEntry();
+
+        std::string                    mime;
+        Hyprutils::OS::CFileDescriptor readFD; // prefetch in flight
+        wl_event_source*               readSource = nullptr;
+        std::vector<uint8_t>           buffer;
+        Hyprutils::OS::CFileDescriptor memfd; // valid once the source sent all of it
+        size_t                         size = 0;
+    };
+
+    struct SSelection {
+        WP<IDataSource>         source;
+        Time::steady_tp         since;
+        std::vector<SP<SEntry>> entries; // in misc:selection_cache_mimes order
+    };
+
+    struct SServe {
+        ~SServe();
+
+        SP<SEntry>                     entry; // keeps the memfd around if it's evicted meanwhile
+        Hyprutils::OS::CFileDescriptor fd;
+        off_t                          offset      = 0;
+        wl_event_source*               writeSource = nullptr;
+    };
+
+    void                    onSelection(SSelection& selection, SP<IDataSource> source);
+    void                    onReadable(SEntry* entry);
+    void                    onWritable(SServe* serve);
+    bool                    writeOut(SServe* serve);
+    void                    dropEntry(SEntry* entry);
+    size_t                  cachedSize();
+    void                    evict();
+
+    SSelection              m_clipboard, m_primary;
+    std::vector<UP<SServe>> m_serving;
+    SP<CEventLoopTimer>     m_ageTimer;
+
+    struct {
+        CHyprSignalListener setSelection;
+        CHyprSignalListener setPrimarySelection;
+    } m_listeners;
+};
+
+inline UP<CSelectionCacheManager> g_pSelectionCacheManager;
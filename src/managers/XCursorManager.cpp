@@ -15,6 +15,7 @@ extern "C" {
 #include "../managers/CursorManager.hpp"
 #include "debug/Log.hpp"
 #include "XCursorManager.hpp"
+#include "helpers/time/Time.hpp"
 #include <memory>
 #include <variant>
 
@@ -113,27 +114,29 @@ void CXCursorManager::loadTheme(std::string const& name, int size, float scale)
     if (m_lastLoadSize == (size * std::ceil(scale)) && m_themeName == name && m_lastLoadScale == scale)
         return;
 
+    const auto BEGIN = Time::steadyNow();
+
     m_lastLoadSize  = size * std::ceil(scale);
     m_lastLoadScale = scale;
     m_themeName     = name.empty() ? "default" : name;
     m_defaultCursor.reset();
+    m_shapeIndex.clear();
     m_cursors.clear();
 
+    // only index the theme here, shapes are decoded on first use. Themes ship hundreds of shapes at several sizes, and we only ever show a handful.
     auto paths = themePaths(m_themeName);
     if (paths.empty()) {
         Debug::log(ERR, "XCursor librarypath is empty loading standard XCursors");
-        m_cursors = loadStandardCursors(m_themeName, m_lastLoadSize);
+        indexStandardCursors();
     } else {
         for (auto const& p : paths) {
             try {
-                auto dirCursors = loadAllFromDir(p, m_lastLoadSize);
-                std::copy_if(dirCursors.begin(), dirCursors.end(), std::back_inserter(m_cursors),
-                             [this](auto const& p) { return std::none_of(m_cursors.begin(), m_cursors.end(), [&p](auto const& dp) { return dp->shape == p->shape; }); });
+                indexDir(p);
             } catch (std::exception& e) { Debug::log(ERR, "XCursor path {} can't be loaded: threw error {}", p, e.what()); }
         }
     }
 
-    if (m_cursors.empty()) {
+    if (m_shapeIndex.empty()) {
         Debug::log(ERR, "XCursor failed finding any shapes in theme \"{}\".", m_themeName);
         m_defaultCursor = m_hyprCursor;
         return;
@@ -144,25 +147,24 @@ void CXCursorManager::loadTheme(std::string const& name, int size, float scale)
         if (legacyName.empty())
             continue;
 
-        auto it = std::find_if(m_cursors.begin(), m_cursors.end(), [&legacyName](auto const& c) { return c->shape == legacyName; });
+        const auto IT = m_shapeIndex.find(legacyName);
 
-        if (it == m_cursors.end()) {
+        if (IT == m_shapeIndex.end()) {
             Debug::log(LOG, "XCursor failed to find a legacy shape with name {}, skipping", legacyName);
             continue;
         }
 
-        if (std::any_of(m_cursors.begin(), m_cursors.end(), [&shape](auto const& dp) { return dp->shape == shape; })) {
+        if (m_shapeIndex.contains(shape)) {
             Debug::log(LOG, "XCursor already has a shape {} loaded, skipping", shape);
             continue;
         }
 
-        auto cursor    = makeShared<SXCursors>();
-        cursor->images = it->get()->images;
-        cursor->shape  = shape;
-
-        m_cursors.emplace_back(cursor);
+        m_shapeIndex.emplace(shape, IT->second);
     }
 
+    Debug::log(LOG, "XCursor indexed {} shapes of theme {} in {:.2f}ms, decoding them on first use", m_shapeIndex.size(), m_themeName,
+               std::chrono::duration_cast<std::chrono::microseconds>(Time::steadyNow() - BEGIN).count() / 1000.F);
+
     syncGsettings();
 }
 
@@ -172,14 +174,96 @@ SP<SXCursors> CXCursorManager::getShape(std::string const& shape, int size, floa
         loadTheme(m_themeName, size, scale);
 
     // try to get an icon we know if we have one
-    for (auto const& c : m_cursors) {
-        if (c->shape != shape)
-            continue;
+    if (auto cursor = findShape(shape); cursor)
+        return cursor;
+
+    Debug::log(WARN, "XCursor couldn't find shape {} , using default cursor instead", shape);
+    return defaultCursor();
+}
+
+SP<SXCursors> CXCursorManager::findShape(std::string const& shape) {
+    if (const auto IT = m_cursors.find(shape); IT != m_cursors.end())
+        return IT->second;
+
+    const auto IT = m_shapeIndex.find(shape);
+    if (IT == m_shapeIndex.end())
+        return nullptr;
 
-        return c;
+    auto cursor = loadShape(shape, IT->second);
+    if (!cursor) {
+        // broken file, don't try it again
+        m_shapeIndex.erase(IT);
+        return nullptr;
     }
 
-    Debug::log(WARN, "XCursor couldn't find shape {} , using default cursor instead", shape);
+    m_cursors.emplace(shape, cursor);
+    return cursor;
+}
+
+SP<SXCursors> CXCursorManager::loadShape(std::string const& shape, const SShapeSource& source) {
+    const auto     BEGIN   = Time::steadyNow();
+    XcursorImages* xImages = nullptr;
+
+    if (source.standardIndex >= 0) {
+        xImages = XcursorShapeLoadImages(source.standardIndex << 1 /* wtf xcursor? */, m_themeName.c_str(), m_lastLoadSize);
+
+        if (!xImages) {
+            Debug::log(WARN, "XCursor failed to find a shape with name {}, trying size 24.", shape);
+            xImages = XcursorShapeLoadImages(source.standardIndex << 1 /* wtf xcursor? */, m_themeName.c_str(), 24);
+        }
+    } else {
+        using PcloseType = int (*)(FILE*);
+        const std::unique_ptr<FILE, PcloseType> f(fopen(source.path.c_str(), "r"), static_cast<PcloseType>(fclose));
+
+        if (!f)
+            return nullptr;
+
+        xImages = XcursorFileLoadImages(f.get(), m_lastLoadSize);
+
+        if (!xImages) {
+            Debug::log(WARN, "XCursor failed to load image {}, trying size 24.", source.path);
+            rewind(f.get());
+            xImages = XcursorFileLoadImages(f.get(), 24);
+        }
+    }
+
+    if (!xImages) {
+        Debug::log(WARN, "XCursor failed to load shape {}, skipping", shape);
+        return nullptr;
+    }
+
+    auto cursor = createCursor(shape, xImages);
+    XcursorImagesDestroy(xImages);
+
+    size_t bytes = 0;
+    for (auto const& i : cursor->images) {
+        bytes += i.pixels.size() * sizeof(uint32_t);
+    }
+
+    Debug::log(LOG, "XCursor decoded shape {} on first use: {} images, {} KiB in {:.2f}ms", shape, cursor->images.size(), bytes / 1024,
+               std::chrono::duration_cast<std::chrono::microseconds>(Time::steadyNow() - BEGIN).count() / 1000.F);
+
+    return cursor;
+}
+
+SP<SXCursors> CXCursorManager::defaultCursor() {
+    if (m_defaultCursor)
+        return m_defaultCursor;
+
+    m_defaultCursor = findShape("left_ptr");
+
+    if (!m_defaultCursor)
+        m_defaultCursor = findShape("arrow");
+
+    // broken theme.. just pick anything that loads.
+    while (!m_defaultCursor && !m_shapeIndex.empty()) {
+        const auto NAME = m_shapeIndex.begin()->first;
+        m_defaultCursor = findShape(NAME);
+    }
+
+    if (!m_defaultCursor)
+        m_defaultCursor = m_hyprCursor;
+
     return m_defaultCursor;
 }
 
@@ -483,86 +567,27 @@ static std::array<const char*, 77> XCURSOR_STANDARD_NAMES = {
 };
 // clang-format on
 
-std::vector<SP<SXCursors>> CXCursorManager::loadStandardCursors(std::string const& name, int size) {
-    std::vector<SP<SXCursors>> newCursors;
-
-    // load the default xcursor shapes that exist in the theme
+void CXCursorManager::indexStandardCursors() {
+    // libXcursor looks these up by itself, whether the theme has them is only known once we try to load one
     for (size_t i = 0; i < XCURSOR_STANDARD_NAMES.size(); ++i) {
-        std::string shape{XCURSOR_STANDARD_NAMES[i]};
-        auto        xImages = XcursorShapeLoadImages(i << 1 /* wtf xcursor? */, name.c_str(), size);
-
-        if (!xImages) {
-            Debug::log(WARN, "XCursor failed to find a shape with name {}, trying size 24.", shape);
-            xImages = XcursorShapeLoadImages(i << 1 /* wtf xcursor? */, name.c_str(), 24);
-
-            if (!xImages) {
-                Debug::log(WARN, "XCursor failed to find a shape with name {}, skipping", shape);
-                continue;
-            }
-        }
-
-        auto cursor = createCursor(shape, xImages);
-        newCursors.emplace_back(cursor);
-
-        if (!m_defaultCursor && (shape == "left_ptr" || shape == "arrow"))
-            m_defaultCursor = cursor;
-
-        XcursorImagesDestroy(xImages);
+        m_shapeIndex.emplace(XCURSOR_STANDARD_NAMES[i], SShapeSource{.standardIndex = (int)i});
     }
-
-    // broken theme.. just set it.
-    if (!newCursors.empty() && !m_defaultCursor)
-        m_defaultCursor = newCursors.front();
-
-    return newCursors;
 }
 
-std::vector<SP<SXCursors>> CXCursorManager::loadAllFromDir(std::string const& path, int size) {
-    std::vector<SP<SXCursors>> newCursors;
-
-    if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-        for (const auto& entry : std::filesystem::directory_iterator(path)) {
-            std::error_code e1, e2;
-            if ((!entry.is_regular_file(e1) && !entry.is_symlink(e2)) || e1 || e2) {
-                Debug::log(WARN, "XCursor failed to load shape {}: {}", entry.path().stem().string(), e1 ? e1.message() : e2.message());
-                continue;
-            }
-
-            auto const& full = entry.path().string();
-            using PcloseType = int (*)(FILE*);
-            const std::unique_ptr<FILE, PcloseType> f(fopen(full.c_str(), "r"), static_cast<PcloseType>(fclose));
-
-            if (!f)
-                continue;
-
-            auto xImages = XcursorFileLoadImages(f.get(), size);
-
-            if (!xImages) {
-                Debug::log(WARN, "XCursor failed to load image {}, trying size 24.", full);
-                xImages = XcursorFileLoadImages(f.get(), 24);
-
-                if (!xImages) {
-                    Debug::log(WARN, "XCursor failed to load image {}, skipping", full);
-                    continue;
-                }
-            }
-
-            auto const& shape  = entry.path().filename().string();
-            auto        cursor = createCursor(shape, xImages);
-            newCursors.emplace_back(cursor);
-
-            if (!m_defaultCursor && (shape == "left_ptr" || shape == "arrow"))
-                m_defaultCursor = cursor;
+void CXCursorManager::indexDir(std::string const& path) {
+    if (!std::filesystem::exists(path) || !std::filesystem::is_directory(path))
+        return;
 
-            XcursorImagesDestroy(xImages);
+    for (const auto& entry : std::filesystem::directory_iterator(path)) {
+        std::error_code e1, e2;
+        if ((!entry.is_regular_file(e1) && !entry.is_symlink(e2)) || e1 || e2) {
+            Debug::log(WARN, "XCursor failed to load shape {}: {}", entry.path().stem().string(), e1 ? e1.message() : e2.message());
+            continue;
         }
-    }
 
-    // broken theme.. just set it.
-    if (!newCursors.empty() && !m_defaultCursor)
-        m_defaultCursor = newCursors.front();
-
-    return newCursors;
+        // first theme path to provide a shape wins
+        m_shapeIndex.emplace(entry.path().filename().string(), SShapeSource{.path = entry.path().string()});
+    }
 }
 
 void CXCursorManager::syncGsettings() {
@@ -2,6 +2,7 @@
 #include <string>
 #include <vector>
 #include <set>
+#include <unordered_map>
 #include <array>
 #include <cstdint>
 #include <hyprutils/math/Vector2D.hpp>
@@ -30,16 +31,27 @@ class CXCursorManager {
     void          syncGsettings();
 
   private:
-    SP<SXCursors>              createCursor(std::string const& shape, void* /* XcursorImages* */ xImages);
-    std::set<std::string>      themePaths(std::string const& theme);
-    std::string                getLegacyShapeName(std::string const& shape);
-    std::vector<SP<SXCursors>> loadStandardCursors(std::string const& name, int size);
-    std::vector<SP<SXCursors>> loadAllFromDir(std::string const& path, int size);
-
-    int                        m_lastLoadSize  = 0;
-    float                      m_lastLoadScale = 0;
-    std::string                m_themeName     = "";
-    SP<SXCursors>              m_defaultCursor;
-    SP<SXCursors>              m_hyprCursor;
-    std::vector<SP<SXCursors>> m_cursors;
+    // where a shape gets decoded from, either a file in one of the theme dirs or a libXcursor standard shape
+    struct SShapeSource {
+        std::string path;
+        int         standardIndex = -1;
+    };
+
+    SP<SXCursors>                                  createCursor(std::string const& shape, void* /* XcursorImages* */ xImages);
+    SP<SXCursors>                                  findShape(std::string const& shape);
+    SP<SXCursors>                                  loadShape(std::string const& shape, const SShapeSource& source);
+    SP<SXCursors>                                  defaultCursor();
+    std::set<std::string>                          themePaths(std::string const& theme);
+    std::string                                    getLegacyShapeName(std::string const& shape);
+    void                                           indexStandardCursors();
+    void                                           indexDir(std::string const& path);
+
+    int                                            m_lastLoadSize  = 0;
+    float                                          m_lastLoadScale = 0;
+    std::string                                    m_themeName     = "";
+    SP<SXCursors>                                  m_defaultCursor;
+    SP<SXCursors>                                  m_hyprCursor;
+
+    std::unordered_map<std::string, SShapeSource>  m_shapeIndex; // filled on theme load
+    std::unordered_map<std::string, SP<SXCursors>> m_cursors;    // decoded on first use
 };
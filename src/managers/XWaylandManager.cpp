@@ -74,7 +74,7 @@ void CHyprXWaylandManager::activateWindow(PHLWINDOW pWindow, bool activate) {
     }
 
     if (!pWindow->m_pinned)
-        pWindow->m_workspace->m_lastFocusedWindow = pWindow;
+        pWindow->workspace()->m_lastFocusedWindow = pWindow;
 }
 
 CBox CHyprXWaylandManager::getGeometryForWindow(PHLWINDOW pWindow) {
@@ -9,6 +9,7 @@
 
 #include <sys/timerfd.h>
 #include <ctime>
+#include <unistd.h>
 
 #include <aquamarine/backend/Backend.hpp>
 using namespace Hyprutils::OS;
@@ -16,7 +17,7 @@ using namespace Hyprutils::OS;
 #define TIMESPEC_NSEC_PER_SEC 1000000000L
 
 CEventLoopManager::CEventLoopManager(wl_display* display, wl_event_loop* wlEventLoop) {
-    m_timers.timerfd  = CFileDescriptor{timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC)};
+    m_timers.timerfd  = CFileDescriptor{timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK)};
     m_wayland.loop    = wlEventLoop;
     m_wayland.display = display;
 }
@@ -100,9 +101,36 @@ void CEventLoopManager::enterLoop() {
     Debug::log(LOG, "Kicked off the event loop! :(");
 }
 
+// std heaps are max-heaps, this puts the earliest deadline in front
+static constexpr auto deadlineLater = [](const auto& a, const auto& b) { return a.at > b.at; };
+
 void CEventLoopManager::onTimerFire() {
-    for (auto const& t : m_timers.timers) {
-        if (t.strongRef() > 1 /* if it's 1, it was lost. Don't call it. */ && t->passed() && !t->cancelled())
+    // consume the expiry, a fired timerfd is disarmed and must not stay readable
+    uint64_t expirations = 0;
+    read(m_timers.timerfd.get(), &expirations, sizeof(expirations));
+    m_timers.armedFor.reset();
+
+    const auto                       NOW = Time::steadyNow();
+    std::vector<SP<CEventLoopTimer>> due;
+
+    // collect first, callbacks re-arm and would otherwise land back on the heap mid-walk
+    while (!m_timers.deadlines.empty() && m_timers.deadlines.front().at <= NOW) {
+        std::ranges::pop_heap(m_timers.deadlines, deadlineLater);
+        const auto DEADLINE = std::move(m_timers.deadlines.back());
+        m_timers.deadlines.pop_back();
+
+        if (isCurrent(DEADLINE))
+            due.emplace_back(DEADLINE.timer.lock());
+    }
+
+    for (auto const& t : due) {
+        if (t.strongRef() <= 2 /* only us and the map. It was lost, don't call it. */) {
+            m_timers.timers.erase(t.get());
+            continue;
+        }
+
+        // an earlier callback in this round may have re-armed or cancelled it
+        if (!t->cancelled() && t->expiresAt() && *t->expiresAt() <= NOW)
             t->call(t);
     }
 
@@ -110,15 +138,66 @@ void CEventLoopManager::onTimerFire() {
 }
 
 void CEventLoopManager::addTimer(SP<CEventLoopTimer> timer) {
-    m_timers.timers.push_back(timer);
-    nudgeTimers();
+    // lost timers that are never armed again leave no deadline behind, only a sweep gets rid of them.
+    // Doing it whenever the map doubled keeps adds amortized O(1)
+    if (m_timers.timers.size() >= m_timers.sweepAt)
+        sweepLostTimers();
+
+    m_timers.timers[timer.get()] = timer;
+    pushDeadline(timer);
 }
 
 void CEventLoopManager::removeTimer(SP<CEventLoopTimer> timer) {
-    std::erase_if(m_timers.timers, [timer](const auto& t) { return timer == t; });
+    // its deadline is left on the heap and dropped once it surfaces
+    m_timers.timers.erase(timer.get());
+    nudgeTimers();
+}
+
+void CEventLoopManager::onTimerUpdated(CEventLoopTimer* timer) {
+    const auto IT = m_timers.timers.find(timer);
+
+    // not added yet, addTimer will queue it
+    if (IT == m_timers.timers.end())
+        return;
+
+    pushDeadline(IT->second);
+}
+
+void CEventLoopManager::pushDeadline(SP<CEventLoopTimer> timer) {
+    if (const auto AT = timer->expiresAt(); AT) {
+        m_timers.deadlines.emplace_back(STimerDeadline{.at = *AT, .timer = timer});
+        std::ranges::push_heap(m_timers.deadlines, deadlineLater);
+    }
+
+    // timers re-armed over and over before they fire leave stale deadlines behind, keep them bounded
+    if (m_timers.deadlines.size() > m_timers.timers.size() * 2 + 64)
+        compactDeadlines();
+
     nudgeTimers();
 }
 
+bool CEventLoopManager::isCurrent(const STimerDeadline& deadline) {
+    const auto TIMER = deadline.timer.lock();
+
+    if (!TIMER || !m_timers.timers.contains(TIMER.get()))
+        return false;
+
+    const auto AT = TIMER->expiresAt();
+    return AT && *AT == deadline.at;
+}
+
+void CEventLoopManager::sweepLostTimers() {
+    std::erase_if(m_timers.timers, [](const auto& el) { return el.second.strongRef() <= 1; });
+    m_timers.sweepAt = std::max<size_t>(m_timers.timers.size() * 2, 64);
+}
+
+void CEventLoopManager::compactDeadlines() {
+    sweepLostTimers();
+
+    std::erase_if(m_timers.deadlines, [this](const auto& d) { return !isCurrent(d); });
+    std::ranges::make_heap(m_timers.deadlines, deadlineLater);
+}
+
 static void timespecAddNs(timespec* pTimespec, int64_t delta) {
     auto delta_ns_low = delta % TIMESPEC_NSEC_PER_SEC;
     auto delta_s_high = delta / TIMESPEC_NSEC_PER_SEC;
@@ -133,23 +212,30 @@ static void timespecAddNs(timespec* pTimespec, int64_t delta) {
 }
 
 void CEventLoopManager::nudgeTimers() {
-    // remove timers that have gone missing
-    std::erase_if(m_timers.timers, [](const auto& t) { return t.strongRef() <= 1; });
+    while (!m_timers.deadlines.empty() && !isCurrent(m_timers.deadlines.front())) {
+        std::ranges::pop_heap(m_timers.deadlines, deadlineLater);
+        m_timers.deadlines.pop_back();
+    }
 
-    long nextTimerUs = 10L * 1000 * 1000; // 10s
+    const auto NEXT = m_timers.deadlines.empty() ? std::nullopt : std::optional<Time::steady_tp>{m_timers.deadlines.front().at};
 
-    for (auto const& t : m_timers.timers) {
-        if (auto const& µs = t->leftUs(); µs < nextTimerUs)
-            nextTimerUs = µs;
-    }
+    if (NEXT == m_timers.armedFor)
+        return;
+
+    m_timers.armedFor = NEXT;
 
-    nextTimerUs = std::clamp(nextTimerUs + 1, 1L, std::numeric_limits<long>::max());
+    // nothing armed, a zeroed it_value disarms the timerfd
+    itimerspec ts = {};
 
-    timespec now;
-    clock_gettime(CLOCK_MONOTONIC, &now);
-    timespecAddNs(&now, nextTimerUs * 1000L);
+    if (NEXT) {
+        const long nextTimerUs = std::clamp<long>(std::chrono::duration_cast<std::chrono::microseconds>(*NEXT - Time::steadyNow()).count() + 1, 1L, std::numeric_limits<long>::max());
 
-    itimerspec ts = {.it_value = now};
+        timespec   now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        timespecAddNs(&now, nextTimerUs * 1000L);
+
+        ts.it_value = now;
+    }
 
     timerfd_settime(m_timers.timerfd.get(), TFD_TIMER_ABSTIME, &ts, nullptr);
 }
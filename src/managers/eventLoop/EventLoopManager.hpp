@@ -4,6 +4,7 @@
 #include <map>
 #include <mutex>
 #include <thread>
+#include <unordered_map>
 #include <wayland-server.h>
 #include "helpers/signal/Signal.hpp"
 #include <hyprutils/os/FileDescriptor.hpp>
@@ -27,7 +28,10 @@ class CEventLoopManager {
 
     void onTimerFire();
 
-    // recalculates timers
+    // queues the timer's new deadline, called by the timer itself on updateTimeout
+    void onTimerUpdated(CEventLoopTimer* timer);
+
+    // re-arms the timerfd for the earliest deadline, no-op if that didn't change
     void nudgeTimers();
 
     // schedules a function to run later, aka in a wayland idle event.
@@ -64,9 +68,23 @@ class CEventLoopManager {
         wl_event_source* eventSource = nullptr;
     } m_wayland;
 
+    struct STimerDeadline {
+        Time::steady_tp     at;
+        WP<CEventLoopTimer> timer;
+    };
+
+    // a deadline is stale once its timer got re-armed, disarmed or fired since it was queued
+    bool isCurrent(const STimerDeadline& deadline);
+    void pushDeadline(SP<CEventLoopTimer> timer);
+    void compactDeadlines();
+    void sweepLostTimers();
+
     struct {
-        std::vector<SP<CEventLoopTimer>> timers;
-        Hyprutils::OS::CFileDescriptor   timerfd;
+        std::unordered_map<CEventLoopTimer*, SP<CEventLoopTimer>> timers;
+        std::vector<STimerDeadline>                               deadlines; // min-heap on at, stale ones are dropped as they surface
+        std::optional<Time::steady_tp>                            armedFor;
+        size_t                                                    sweepAt = 64; // timer count that triggers the next lost timer sweep
+        Hyprutils::OS::CFileDescriptor                            timerfd;
     } m_timers;
 
     SIdleData                        m_idle;
@@ -12,15 +12,12 @@ CEventLoopTimer::CEventLoopTimer(std::optional<Time::steady_dur> timeout, std::f
 }
 
 void CEventLoopTimer::updateTimeout(std::optional<Time::steady_dur> timeout) {
-    if (!timeout.has_value()) {
+    if (!timeout.has_value())
         m_expires.reset();
-        g_pEventLoopManager->nudgeTimers();
-        return;
-    }
-
-    m_expires = Time::steadyNow() + *timeout;
+    else
+        m_expires = Time::steadyNow() + *timeout;
 
-    g_pEventLoopManager->nudgeTimers();
+    g_pEventLoopManager->onTimerUpdated(this);
 }
 
 bool CEventLoopTimer::passed() {
@@ -50,6 +47,10 @@ float CEventLoopTimer::leftUs() {
     return std::chrono::duration_cast<std::chrono::microseconds>(*m_expires - Time::steadyNow()).count();
 }
 
+std::optional<Time::steady_tp> CEventLoopTimer::expiresAt() {
+    return m_expires;
+}
+
 bool CEventLoopTimer::armed() {
     return m_expires.has_value();
 }
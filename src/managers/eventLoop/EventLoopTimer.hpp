@@ -13,15 +13,16 @@ class CEventLoopTimer {
 
     // if not specified, disarms.
     // if specified, arms.
-    void  updateTimeout(std::optional<Time::steady_dur> timeout);
+    void                           updateTimeout(std::optional<Time::steady_dur> timeout);
 
-    void  cancel();
-    bool  passed();
-    bool  armed();
+    void                           cancel();
+    bool                           passed();
+    bool                           armed();
 
-    float leftUs();
+    float                          leftUs();
+    std::optional<Time::steady_tp> expiresAt();
 
-    bool  cancelled();
+    bool                           cancelled();
     // resets expires
     void call(SP<CEventLoopTimer> self);
 
@@ -27,6 +27,7 @@
 #include "../../devices/VirtualPointer.hpp"
 #include "../../devices/Keyboard.hpp"
 #include "../../devices/VirtualKeyboard.hpp"
+#include "../../devices/KeymapCache.hpp"
 #include "../../devices/TouchDevice.hpp"
 
 #include "../../managers/PointerManager.hpp"
@@ -38,6 +39,9 @@
 #include "../../managers/LayoutManager.hpp"
 
 #include "../../helpers/time/Time.hpp"
+#include "../../managers/eventLoop/EventLoopManager.hpp"
+#include "../../debug/FrameTracer.hpp"
+#include "../../debug/FrameMetrics.hpp"
 
 #include <aquamarine/input/Input.hpp>
 
@@ -77,9 +81,15 @@ CInputManager::CInputManager() {
     m_listeners.setCursor          = g_pSeatManager->m_events.setCursor.registerListener([this](std::any d) { this->processMouseRequest(d); });
 
     m_cursorSurfaceInfo.wlSurface = CWLSurface::create();
+
+    m_coalescedMotion.timer = makeShared<CEventLoopTimer>(std::nullopt, [this](SP<CEventLoopTimer> self, void* data) { flushCoalescedMotion(); }, nullptr);
+    g_pEventLoopManager->addTimer(m_coalescedMotion.timer);
 }
 
 CInputManager::~CInputManager() {
+    if (g_pEventLoopManager)
+        g_pEventLoopManager->removeTimer(m_coalescedMotion.timer);
+
     m_constraints.clear();
     m_keyboards.clear();
     m_pointers.clear();
@@ -92,7 +102,11 @@ CInputManager::~CInputManager() {
 }
 
 void CInputManager::onMouseMoved(IPointer::SMotionEvent e) {
-    static auto PNOACCEL = CConfigValue<Hyprlang::INT>("input:force_no_accel");
+    TRACE_SCOPE("mouseMoved", TRACE_CATEGORY_INPUT);
+    g_pFrameMetrics->onInput();
+
+    static auto PNOACCEL  = CConfigValue<Hyprlang::INT>("input:force_no_accel");
+    static auto PCOALESCE = CConfigValue<Hyprlang::INT>("input:motion_coalescing");
 
     Vector2D    delta   = e.delta;
     Vector2D    unaccel = e.unaccel;
@@ -124,7 +138,14 @@ void CInputManager::onMouseMoved(IPointer::SMotionEvent e) {
 
     g_pPointerManager->move(DELTA);
 
-    mouseMoveUnified(e.timeMs, false, e.mouse);
+    // the cursor and relative motion above stay per event, focus and wl_pointer motion can wait.
+    // Not while locked or confined though, mouseMoveUnified is what holds the cursor in the region
+    if (*PCOALESCE > 0 && !isConstrained())
+        coalesceMotion(e.timeMs, e.mouse);
+    else {
+        flushCoalescedMotion();
+        mouseMoveUnified(e.timeMs, false, e.mouse);
+    }
 
     m_lastCursorMovement.reset();
 
@@ -135,6 +156,8 @@ void CInputManager::onMouseMoved(IPointer::SMotionEvent e) {
 }
 
 void CInputManager::onMouseWarp(IPointer::SMotionAbsoluteEvent e) {
+    flushCoalescedMotion();
+
     g_pPointerManager->warpAbsolute(e.absolute, e.device);
 
     mouseMoveUnified(e.timeMs);
@@ -144,6 +167,50 @@ void CInputManager::onMouseWarp(IPointer::SMotionAbsoluteEvent e) {
     m_lastInputTouch = false;
 }
 
+void CInputManager::coalesceMotion(uint32_t timeMs, bool mouse) {
+    static auto PCOALESCE = CConfigValue<Hyprlang::INT>("input:motion_coalescing");
+
+    const auto  INTERVAL = std::chrono::milliseconds(*PCOALESCE);
+    const auto  NOW      = Time::steadyNow();
+
+    // the first motion after a quiet period goes out right away, only the rest of a burst waits
+    if (!m_coalescedMotion.pending && NOW - m_coalescedMotion.lastFlush >= INTERVAL) {
+        m_coalescedMotion.lastFlush = NOW;
+        mouseMoveUnified(timeMs, false, mouse);
+        return;
+    }
+
+    m_coalescedMotion.timeMs = timeMs;
+    m_coalescedMotion.mouse  = m_coalescedMotion.mouse || mouse;
+
+    if (m_coalescedMotion.pending)
+        return;
+
+    m_coalescedMotion.pending = true;
+    m_coalescedMotion.timer->updateTimeout(m_coalescedMotion.lastFlush + INTERVAL - NOW);
+}
+
+void CInputManager::flushCoalescedMotion() {
+    if (!m_coalescedMotion.pending)
+        return;
+
+    const bool MOUSE = m_coalescedMotion.mouse;
+
+    m_coalescedMotion.pending   = false;
+    m_coalescedMotion.mouse     = false;
+    m_coalescedMotion.lastFlush = Time::steadyNow();
+    m_coalescedMotion.timer->updateTimeout(std::nullopt);
+
+    mouseMoveUnified(m_coalescedMotion.timeMs, false, MOUSE);
+
+    // the frame of the last folded motion was held back
+    g_pSeatManager->sendPointerFrame();
+}
+
+bool CInputManager::hasCoalescedMotion() {
+    return m_coalescedMotion.pending;
+}
+
 void CInputManager::simulateMouseMovement() {
     m_lastCursorPosFloored = m_lastCursorPosFloored - Vector2D(1, 1); // hack: force the mouseMoveUnified to report without making this a refocus.
     mouseMoveUnified(Time::millis(Time::steadyNow()));
@@ -371,7 +438,7 @@ void CInputManager::mouseMoveUnified(uint32_t time, bool refocus, bool mouse) {
 
         if (PWINDOWIDEAL &&
             ((PWINDOWIDEAL->m_isFloating && PWINDOWIDEAL->m_createdOverFullscreen) /* floating over fullscreen */
-             || (PMONITOR->m_activeSpecialWorkspace == PWINDOWIDEAL->m_workspace) /* on an open special workspace */))
+             || (PMONITOR->m_activeSpecialWorkspace == PWINDOWIDEAL->workspace()) /* on an open special workspace */))
             pFoundWindow = PWINDOWIDEAL;
 
         if (!pFoundWindow->m_isX11) {
@@ -603,6 +670,11 @@ void CInputManager::mouseMoveUnified(uint32_t time, bool refocus, bool mouse) {
 }
 
 void CInputManager::onMouseButton(IPointer::SButtonEvent e) {
+    TRACE_SCOPE("mouseButton", TRACE_CATEGORY_INPUT, "button", e.button);
+    g_pFrameMetrics->onInput();
+
+    flushCoalescedMotion();
+
     EMIT_HOOK_EVENT_CANCELLABLE("mouseButton", e);
 
     if (e.mouse)
@@ -830,6 +902,11 @@ void CInputManager::processMouseDownKill(const IPointer::SButtonEvent& e) {
 }
 
 void CInputManager::onMouseWheel(IPointer::SAxisEvent e) {
+    TRACE_SCOPE("mouseWheel", TRACE_CATEGORY_INPUT);
+    g_pFrameMetrics->onInput();
+
+    flushCoalescedMotion();
+
     static auto POFFWINDOWAXIS        = CConfigValue<Hyprlang::INT>("input:off_window_axis_events");
     static auto PINPUTSCROLLFACTOR    = CConfigValue<Hyprlang::FLOAT>("input:scroll_factor");
     static auto PTOUCHPADSCROLLFACTOR = CConfigValue<Hyprlang::FLOAT>("input:touchpad:scroll_factor");
@@ -1021,10 +1098,25 @@ void CInputManager::setupKeyboard(SP<IKeyboard> keeb) {
 }
 
 void CInputManager::setKeyboardLayout() {
+    const auto BEGIN = Time::steadyNow();
+
+    // compile every distinct keymap in parallel first, applying below then mostly waits on the slowest one.
+    // Unchanged ones are cached and cost nothing.
+    for (auto const& k : m_keyboards) {
+        if (!k->m_keymapOverridden)
+            CKeymapCache::prefetchForDevice(k->m_hlName);
+    }
+    CKeymapCache::prefetchForDevice(""); // binds
+
     for (auto const& k : m_keyboards)
         applyConfigToKeyboard(k);
 
     g_pKeybindManager->updateXKBTranslationState();
+
+    CKeymapCache::prune();
+
+    Debug::log(LOG, "Applied the keyboard config to {} keyboards in {:.2f}ms", m_keyboards.size(),
+               std::chrono::duration_cast<std::chrono::microseconds>(Time::steadyNow() - BEGIN).count() / 1000.F);
 }
 
 void CInputManager::applyConfigToKeyboard(SP<IKeyboard> pKeyboard) {
@@ -1382,6 +1474,11 @@ void CInputManager::updateKeyboardsLeds(SP<IKeyboard> pKeyboard) {
 }
 
 void CInputManager::onKeyboardKey(std::any event, SP<IKeyboard> pKeyboard) {
+    TRACE_SCOPE("keyboardKey", TRACE_CATEGORY_INPUT);
+    g_pFrameMetrics->onInput();
+
+    flushCoalescedMotion();
+
     if (!pKeyboard->m_enabled)
         return;
 
@@ -1413,6 +1510,8 @@ void CInputManager::onKeyboardMod(SP<IKeyboard> pKeyboard) {
     if (!pKeyboard->m_enabled)
         return;
 
+    flushCoalescedMotion();
+
     const bool DISALLOWACTION = pKeyboard->isVirtual() && shouldIgnoreVirtualKeyboard(pKeyboard);
 
     const auto ALLMODS = accumulateModsFromAllKBs();
@@ -1489,7 +1588,7 @@ bool CInputManager::refocusLastWindow(PHLMONITOR pMonitor) {
             foundSurface = nullptr;
     }
 
-    if (!foundSurface && g_pCompositor->m_lastWindow.lock() && g_pCompositor->m_lastWindow->m_workspace && g_pCompositor->m_lastWindow->m_workspace->isVisibleNotCovered()) {
+    if (!foundSurface && g_pCompositor->m_lastWindow.lock() && g_pCompositor->m_lastWindow->workspace() && g_pCompositor->m_lastWindow->workspace()->isVisibleNotCovered()) {
         // then the last focused window if we're on the same workspace as it
         const auto PLASTWINDOW = g_pCompositor->m_lastWindow.lock();
         g_pCompositor->focusWindow(PLASTWINDOW);
@@ -5,6 +5,7 @@
 #include <any>
 #include "../../helpers/WLClasses.hpp"
 #include "../../helpers/time/Timer.hpp"
+#include "../../helpers/time/Time.hpp"
 #include "InputMethodRelay.hpp"
 #include "../../helpers/signal/Signal.hpp"
 #include "../../devices/IPointer.hpp"
@@ -18,6 +19,7 @@ class CIdleInhibitor;
 class CVirtualKeyboardV1Resource;
 class CVirtualPointerV1Resource;
 class IKeyboard;
+class CEventLoopTimer;
 
 AQUAMARINE_FORWARD(IPointer);
 AQUAMARINE_FORWARD(IKeyboard);
@@ -117,6 +119,10 @@ class CInputManager {
     bool               refocusLastWindow(PHLMONITOR pMonitor);
     void               simulateMouseMovement();
     void               sendMotionEventsToFocused();
+    // runs focus resolution for motion held back by input:motion_coalescing.
+    // Anything that has to stay ordered after pointer motion calls this first.
+    void               flushCoalescedMotion();
+    bool               hasCoalescedMotion();
 
     void               setKeyboardLayout();
     void               setPointerConfigs();
@@ -242,6 +248,7 @@ class CInputManager {
     uint32_t           m_capabilities = 0;
 
     void               mouseMoveUnified(uint32_t, bool refocus = false, bool mouse = false);
+    void               coalesceMotion(uint32_t timeMs, bool mouse);
     void               recheckMouseWarpOnMouseInput();
 
     SP<CTabletTool>    ensureTabletToolPresent(SP<Aquamarine::ITabletTool>);
@@ -262,6 +269,15 @@ class CInputManager {
     bool m_focusHeldByButtons   = false;
     bool m_refocusHeldByButtons = false;
 
+    // input:motion_coalescing, the latest motion that didn't run mouseMoveUnified yet
+    struct {
+        bool                pending = false;
+        bool                mouse   = false;
+        uint32_t            timeMs  = 0;
+        Time::steady_tp     lastFlush;
+        SP<CEventLoopTimer> timer;
+    } m_coalescedMotion;
+
     // for releasing mouse buttons
     std::list<uint32_t> m_currentlyHeldButtons;
 
@@ -165,6 +165,8 @@ void CInputManager::onTabletAxis(CTablet::SAxisEvent e) {
 }
 
 void CInputManager::onTabletTip(CTablet::STipEvent e) {
+    flushCoalescedMotion();
+
     const auto PTAB  = e.tablet;
     const auto PTOOL = ensureTabletToolPresent(e.tool);
     const auto POS   = e.tip;
@@ -188,6 +190,8 @@ void CInputManager::onTabletTip(CTablet::STipEvent e) {
 }
 
 void CInputManager::onTabletButton(CTablet::SButtonEvent e) {
+    flushCoalescedMotion();
+
     const auto PTOOL = ensureTabletToolPresent(e.tool);
 
     if (e.down)
@@ -10,8 +10,15 @@
 #include "managers/AnimationManager.hpp"
 #include "../HookSystemManager.hpp"
 #include "debug/Log.hpp"
+#include "debug/FrameTracer.hpp"
+#include "debug/FrameMetrics.hpp"
 
 void CInputManager::onTouchDown(ITouch::SDownEvent e) {
+    TRACE_SCOPE("touchDown", TRACE_CATEGORY_INPUT);
+    g_pFrameMetrics->onInput();
+
+    flushCoalescedMotion();
+
     m_lastInputTouch = true;
 
     static auto PSWIPETOUCH  = CConfigValue<Hyprlang::INT>("gestures:workspace_swipe_touch");
@@ -99,6 +106,9 @@ void CInputManager::onTouchDown(ITouch::SDownEvent e) {
 }
 
 void CInputManager::onTouchUp(ITouch::SUpEvent e) {
+    TRACE_SCOPE("touchUp", TRACE_CATEGORY_INPUT);
+    g_pFrameMetrics->onInput();
+
     m_lastInputTouch = true;
 
     EMIT_HOOK_EVENT_CANCELLABLE("touchUp", e);
@@ -114,6 +124,9 @@ void CInputManager::onTouchUp(ITouch::SUpEvent e) {
 }
 
 void CInputManager::onTouchMove(ITouch::SMotionEvent e) {
+    TRACE_SCOPE("touchMove", TRACE_CATEGORY_INPUT);
+    g_pFrameMetrics->onInput();
+
     m_lastInputTouch = true;
 
     EMIT_HOOK_EVENT_CANCELLABLE("touchMove", e);
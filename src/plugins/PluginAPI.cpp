@@ -73,7 +73,7 @@ APICALL bool HyprlandAPI::removeLayout(HANDLE handle, IHyprLayout* layout) {
 }
 
 APICALL bool HyprlandAPI::reloadConfig() {
-    g_pEventLoopManager->doLater([] { g_pConfigManager->reload(); });
+    g_pConfigManager->scheduleReload();
     return true;
 }
 
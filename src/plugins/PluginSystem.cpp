@@ -132,7 +132,7 @@ std::expected<CPlugin*, std::string> CPluginSystem::loadPluginInternal(const std
     PLUGIN->m_version     = PLUGINDATA.version;
     PLUGIN->m_name        = PLUGINDATA.name;
 
-    g_pEventLoopManager->doLater([] { g_pConfigManager->reload(); });
+    g_pConfigManager->scheduleReload();
 
     Debug::log(LOG, R"( [PluginSystem] Plugin {} loaded. Handle: {:x}, path: "{}", author: "{}", description: "{}", version: "{}")", PLUGINDATA.name, (uintptr_t)MODULE, path,
                PLUGINDATA.author, PLUGINDATA.description, PLUGINDATA.version);
@@ -187,7 +187,7 @@ void CPluginSystem::unloadPlugin(const CPlugin* plugin, bool eject) {
     Debug::log(LOG, " [PluginSystem] Plugin {} unloaded.", PLNAME);
 
     // reload config to fix some stuf like e.g. unloadedPluginVars
-    g_pEventLoopManager->doLater([] { g_pConfigManager->reload(); });
+    g_pConfigManager->scheduleReload();
 }
 
 void CPluginSystem::unloadAllPlugins() {
@@ -1,6 +1,7 @@
 #include "DataDeviceWlr.hpp"
 #include <algorithm>
 #include "../managers/SeatManager.hpp"
+#include "../managers/SelectionCacheManager.hpp"
 #include "core/Seat.hpp"
 using namespace Hyprutils::OS;
 
@@ -25,7 +26,7 @@ CWLRDataOffer::CWLRDataOffer(SP<CZwlrDataControlOfferV1> resource_, SP<IDataSour
 
         LOGM(LOG, "Offer {:x} asks to send data from source {:x}", (uintptr_t)this, (uintptr_t)source.get());
 
-        source->send(mime, std::move(sendFd));
+        g_pSelectionCacheManager->send(source.lock(), mime, std::move(sendFd));
     });
 }
 
@@ -46,7 +46,7 @@ CForeignToplevelHandleWlr::CForeignToplevelHandleWlr(SP<CZwlrForeignToplevelHand
             if (!wpMonitor.expired()) {
                 const auto monitor = wpMonitor.lock();
 
-                if (PWINDOW->m_workspace != monitor->m_activeWorkspace) {
+                if (PWINDOW->workspace() != monitor->m_activeWorkspace) {
                     g_pCompositor->moveWindowToWorkspaceSafe(PWINDOW, monitor->m_activeWorkspace);
                     g_pCompositor->setActiveMonitor(monitor);
                 }
@@ -170,7 +170,7 @@ void CForeignToplevelHandleWlr::sendMonitor(PHLMONITOR pMonitor) {
 void CForeignToplevelHandleWlr::sendState() {
     const auto PWINDOW = pWindow.lock();
 
-    if UNLIKELY (!PWINDOW || !PWINDOW->m_workspace || !PWINDOW->m_isMapped)
+    if UNLIKELY (!PWINDOW || !PWINDOW->workspace() || !PWINDOW->m_isMapped)
         return;
 
     wl_array state;
@@ -13,9 +13,14 @@
 #include "../managers/HookSystemManager.hpp"
 #include "../render/OpenGL.hpp"
 #include "../Compositor.hpp"
+#include "../debug/FrameMetrics.hpp"
+#include "../managers/eventLoop/EventLoopManager.hpp"
 
 using namespace Hyprutils::OS;
 
+// how long scanout eligibility has to stay put before clients hear about it
+constexpr std::chrono::milliseconds FEEDBACK_DEBOUNCE = std::chrono::milliseconds(300);
+
 static std::optional<dev_t> devIDFromFD(int fd) {
     struct stat stat;
     if (fstat(fd, &stat) != 0)
@@ -77,6 +82,11 @@ CDMABUFFormatTable::CDMABUFFormatTable(SDMABUFTranche _rendererTranche, std::vec
         }
     }
 
+    entries.reserve(formatsVec.size());
+    for (auto const& e : formatsVec) {
+        entries.emplace_back(e.fmt, e.modifier);
+    }
+
     tableSize = formatsVec.size() * sizeof(SDMABUFFormatTableEntry);
 
     CFileDescriptor fds[2];
@@ -96,6 +106,19 @@ CDMABUFFormatTable::CDMABUFFormatTable(SDMABUFTranche _rendererTranche, std::vec
     tableFD = std::move(fds[1]);
 }
 
+bool CDMABUFFormatTable::sameEntries(const CDMABUFFormatTable& other) const {
+    return entries == other.entries;
+}
+
+const SDMABUFTranche* CDMABUFFormatTable::trancheFor(PHLMONITOR pMonitor) const {
+    const auto IT = std::ranges::find_if(monitorTranches, [pMonitor](const auto& pair) { return pair.first == pMonitor; });
+    return IT == monitorTranches.end() ? nullptr : &IT->second;
+}
+
+bool SDMABUFTranche::sameAs(const SDMABUFTranche& other) const {
+    return device == other.device && flags == other.flags && indicies == other.indicies;
+}
+
 CLinuxDMABuffer::CLinuxDMABuffer(uint32_t id, wl_client* client, Aquamarine::SDMABUFAttrs attrs) {
     buffer = makeShared<CDMABuffer>(id, client, attrs);
 
@@ -302,14 +325,19 @@ CLinuxDMABUFFeedbackResource::CLinuxDMABUFFeedbackResource(SP<CZwpLinuxDmabufFee
 
     auto& formatTable = PROTO::linuxDma->formatTable;
     resource->sendFormatTable(formatTable->tableFD.get(), formatTable->tableSize);
-    sendDefaultFeedback();
+    sendDefaultFeedback(true);
+}
+
+CLinuxDMABUFFeedbackResource::~CLinuxDMABUFFeedbackResource() {
+    if (debounceTimer && g_pEventLoopManager)
+        g_pEventLoopManager->removeTimer(debounceTimer);
 }
 
 bool CLinuxDMABUFFeedbackResource::good() {
     return resource->resource();
 }
 
-void CLinuxDMABUFFeedbackResource::sendTranche(SDMABUFTranche& tranche) {
+void CLinuxDMABUFFeedbackResource::sendTranche(const SDMABUFTranche& tranche) {
     struct wl_array deviceArr = {
         .size = sizeof(tranche.device),
         .data = (void*)&tranche.device,
@@ -320,16 +348,23 @@ void CLinuxDMABUFFeedbackResource::sendTranche(SDMABUFTranche& tranche) {
 
     wl_array indices = {
         .size = tranche.indicies.size() * sizeof(tranche.indicies.at(0)),
-        .data = tranche.indicies.data(),
+        .data = (void*)tranche.indicies.data(),
     };
     resource->sendTrancheFormats(&indices);
     resource->sendTrancheDone();
 }
 
-// default tranche is based on renderer (egl)
-void CLinuxDMABUFFeedbackResource::sendDefaultFeedback() {
-    auto            mainDevice  = PROTO::linuxDma->mainDevice;
-    auto&           formatTable = PROTO::linuxDma->formatTable;
+// every feedback batch makes clients re-evaluate, and usually reallocate, their buffers. Only send what actually changed,
+// unless forced (a new format table has to be followed by a full batch).
+bool CLinuxDMABUFFeedbackResource::sendFeedback(const std::vector<const SDMABUFTranche*>& tranches, bool force) {
+    const bool SAME = std::ranges::equal(sentTranches, tranches, [](const auto& sent, const auto* t) { return sent.sameAs(*t); });
+
+    if (SAME && !force) {
+        g_pFrameMetrics->onDMABUFFeedback(false);
+        return false;
+    }
+
+    auto            mainDevice = PROTO::linuxDma->mainDevice;
 
     struct wl_array deviceArr = {
         .size = sizeof(mainDevice),
@@ -337,11 +372,77 @@ void CLinuxDMABUFFeedbackResource::sendDefaultFeedback() {
     };
     resource->sendMainDevice(&deviceArr);
 
-    sendTranche(formatTable->rendererTranche);
+    sentTranches.clear();
+    for (auto const& t : tranches) {
+        sendTranche(*t);
+        sentTranches.emplace_back(SDMABUFTranche{.device = t->device, .flags = t->flags, .indicies = t->indicies});
+    }
 
     resource->sendDone();
 
+    g_pFrameMetrics->onDMABUFFeedback(true);
+    return true;
+}
+
+// default tranche is based on renderer (egl)
+void CLinuxDMABUFFeedbackResource::sendDefaultFeedback(bool force) {
+    sendFeedback({&PROTO::linuxDma->formatTable->rendererTranche}, force);
+
     lastFeedbackWasScanout = false;
+    lastScanoutMonitor.reset();
+}
+
+void CLinuxDMABUFFeedbackResource::sendScanoutFeedback(const SDMABUFTranche& monitorTranche, bool force) {
+    // prioritize scnaout tranche but have renderer fallback tranche
+    // also yes formats can be duped here because different tranche flags (ds and no ds)
+    sendFeedback({&monitorTranche, &PROTO::linuxDma->formatTable->rendererTranche}, force);
+
+    lastFeedbackWasScanout = true;
+}
+
+void CLinuxDMABUFFeedbackResource::scheduleScanout(PHLMONITOR pMonitor) {
+    pendingMonitor = pMonitor;
+
+    // flapped back to what the client already has before the timer fired, nothing to send
+    const bool UNCHANGED = pMonitor ? lastFeedbackWasScanout && lastScanoutMonitor == pMonitor : !lastFeedbackWasScanout;
+    if (UNCHANGED) {
+        if (debounceTimer && debounceTimer->armed()) {
+            debounceTimer->updateTimeout(std::nullopt);
+            g_pFrameMetrics->onDMABUFFeedback(false);
+        }
+        return;
+    }
+
+    if (!debounceTimer) {
+        debounceTimer = makeShared<CEventLoopTimer>(std::nullopt, [this](SP<CEventLoopTimer> self, void* data) { applyPending(); }, nullptr);
+        g_pEventLoopManager->addTimer(debounceTimer);
+    }
+
+    debounceTimer->updateTimeout(FEEDBACK_DEBOUNCE);
+}
+
+void CLinuxDMABUFFeedbackResource::applyPending() {
+    debounceTimer->updateTimeout(std::nullopt);
+
+    const auto PMONITOR = pendingMonitor.lock();
+
+    if (!PMONITOR) {
+        LOGM(LOG, "updateScanoutTranche: resetting feedback");
+        sendDefaultFeedback();
+        return;
+    }
+
+    const auto TRANCHE = PROTO::linuxDma->formatTable->trancheFor(PMONITOR);
+
+    if (!TRANCHE) {
+        LOGM(LOG, "updateScanoutTranche: monitor has no tranche");
+        return;
+    }
+
+    LOGM(LOG, "updateScanoutTranche: sending a scanout tranche");
+
+    sendScanoutFeedback(*TRANCHE);
+    lastScanoutMonitor = PMONITOR;
 }
 
 CLinuxDMABUFResource::CLinuxDMABUFResource(SP<CZwpLinuxDmabufV1> resource_) : resource(resource_) {
@@ -491,30 +592,33 @@ void CLinuxDMABufV1Protocol::resetFormatTable() {
     LOGM(LOG, "Resetting format table");
 
     // this might be a big copy
-    auto newFormatTable = makeUnique<CDMABUFFormatTable>(formatTable->rendererTranche, formatTable->monitorTranches);
+    auto       newFormatTable = makeUnique<CDMABUFFormatTable>(formatTable->rendererTranche, formatTable->monitorTranches);
+
+    const bool TABLECHANGED = !newFormatTable->sameEntries(*formatTable);
+
+    // keep the old one alive until we sent the new one
+    auto oldFormatTable = std::move(formatTable);
+    formatTable         = std::move(newFormatTable);
+
+    if (!TABLECHANGED)
+        LOGM(LOG, "Format table entries unchanged, only resending tranches that changed");
 
     for (auto const& feedback : m_vFeedbacks) {
-        feedback->resource->sendFormatTable(newFormatTable->tableFD.get(), newFormatTable->tableSize);
+        if (TABLECHANGED)
+            feedback->resource->sendFormatTable(formatTable->tableFD.get(), formatTable->tableSize);
+
         if (feedback->lastFeedbackWasScanout) {
-            PHLMONITOR mon;
-            auto       HLSurface = CWLSurface::fromResource(feedback->surface);
-            if (auto w = HLSurface->getWindow(); w)
-                if (auto m = w->m_monitor.lock(); m)
-                    mon = m->m_self.lock();
-
-            if (!mon) {
-                feedback->sendDefaultFeedback();
-                return;
-            }
+            const auto PMONITOR = feedback->lastScanoutMonitor.lock();
+            const auto TRANCHE  = PMONITOR ? formatTable->trancheFor(PMONITOR) : nullptr;
 
-            updateScanoutTranche(feedback->surface, mon);
-        } else {
-            feedback->sendDefaultFeedback();
+            if (TRANCHE) {
+                feedback->sendScanoutFeedback(*TRANCHE, TABLECHANGED);
+                continue;
+            }
         }
-    }
 
-    // delete old table after we sent new one
-    formatTable = std::move(newFormatTable);
+        feedback->sendDefaultFeedback(TABLECHANGED);
+    }
 }
 
 void CLinuxDMABufV1Protocol::bindManager(wl_client* client, void* data, uint32_t ver, uint32_t id) {
@@ -558,36 +662,5 @@ void CLinuxDMABufV1Protocol::updateScanoutTranche(SP<CWLSurfaceResource> surface
         return;
     }
 
-    if (!pMonitor) {
-        LOGM(LOG, "updateScanoutTranche: resetting feedback");
-        feedbackResource->sendDefaultFeedback();
-        return;
-    }
-
-    const auto& monitorTranchePair = std::find_if(formatTable->monitorTranches.begin(), formatTable->monitorTranches.end(),
-                                                  [pMonitor](std::pair<PHLMONITORREF, SDMABUFTranche> pair) { return pair.first == pMonitor; });
-
-    if (monitorTranchePair == formatTable->monitorTranches.end()) {
-        LOGM(LOG, "updateScanoutTranche: monitor has no tranche");
-        return;
-    }
-
-    auto& monitorTranche = (*monitorTranchePair).second;
-
-    LOGM(LOG, "updateScanoutTranche: sending a scanout tranche");
-
-    struct wl_array deviceArr = {
-        .size = sizeof(mainDevice),
-        .data = (void*)&mainDevice,
-    };
-    feedbackResource->resource->sendMainDevice(&deviceArr);
-
-    // prioritize scnaout tranche but have renderer fallback tranche
-    // also yes formats can be duped here because different tranche flags (ds and no ds)
-    feedbackResource->sendTranche(monitorTranche);
-    feedbackResource->sendTranche(formatTable->rendererTranche);
-
-    feedbackResource->resource->sendDone();
-
-    feedbackResource->lastFeedbackWasScanout = true;
+    feedbackResource->scheduleScanout(pMonitor);
 }
@@ -13,6 +13,7 @@
 
 class CDMABuffer;
 class CWLSurfaceResource;
+class CEventLoopTimer;
 
 class CLinuxDMABuffer {
   public:
@@ -44,6 +45,8 @@ struct SDMABUFTranche {
     uint32_t                flags  = 0;
     std::vector<SDRMFormat> formats;
     std::vector<uint16_t>   indicies;
+
+    bool                    sameAs(const SDMABUFTranche& other) const; // compares what clients see, not the formats
 };
 
 class CDMABUFFormatTable {
@@ -51,10 +54,14 @@ class CDMABUFFormatTable {
     CDMABUFFormatTable(SDMABUFTranche rendererTranche, std::vector<std::pair<PHLMONITORREF, SDMABUFTranche>> tranches);
     ~CDMABUFFormatTable() = default;
 
+    bool                                                  sameEntries(const CDMABUFFormatTable& other) const; // clients can keep the table they have
+    const SDMABUFTranche*                                 trancheFor(PHLMONITOR pMonitor) const;
+
     Hyprutils::OS::CFileDescriptor                        tableFD;
     size_t                                                tableSize = 0;
     SDMABUFTranche                                        rendererTranche;
     std::vector<std::pair<PHLMONITORREF, SDMABUFTranche>> monitorTranches;
+    std::vector<std::pair<uint32_t, uint64_t>>            entries;
 };
 
 class CLinuxDMABUFParamsResource {
@@ -79,17 +86,27 @@ class CLinuxDMABUFParamsResource {
 class CLinuxDMABUFFeedbackResource {
   public:
     CLinuxDMABUFFeedbackResource(SP<CZwpLinuxDmabufFeedbackV1> resource_, SP<CWLSurfaceResource> surface_);
-    ~CLinuxDMABUFFeedbackResource() = default;
+    ~CLinuxDMABUFFeedbackResource();
 
     bool                   good();
-    void                   sendDefaultFeedback();
-    void                   sendTranche(SDMABUFTranche& tranche);
+    void                   sendDefaultFeedback(bool force = false);
+    void                   sendScanoutFeedback(const SDMABUFTranche& monitorTranche, bool force = false);
+    void                   sendTranche(const SDMABUFTranche& tranche);
+    void                   scheduleScanout(PHLMONITOR pMonitor); // nullptr resets, debounced
 
     SP<CWLSurfaceResource> surface; // optional, for surface feedbacks
 
   private:
     SP<CZwpLinuxDmabufFeedbackV1> resource;
     bool                          lastFeedbackWasScanout = false;
+    PHLMONITORREF                 lastScanoutMonitor;
+    std::vector<SDMABUFTranche>   sentTranches; // last feedback the client got
+
+    SP<CEventLoopTimer>           debounceTimer;
+    PHLMONITORREF                 pendingMonitor; // expired means default feedback
+
+    bool                          sendFeedback(const std::vector<const SDMABUFTranche*>& tranches, bool force);
+    void                          applyPending();
 
     friend class CLinuxDMABufV1Protocol;
 };
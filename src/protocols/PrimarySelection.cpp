@@ -1,6 +1,7 @@
 #include "PrimarySelection.hpp"
 #include <algorithm>
 #include "../managers/SeatManager.hpp"
+#include "../managers/SelectionCacheManager.hpp"
 #include "core/Seat.hpp"
 #include "../config/ConfigValue.hpp"
 using namespace Hyprutils::OS;
@@ -26,7 +27,7 @@ CPrimarySelectionOffer::CPrimarySelectionOffer(SP<CZwpPrimarySelectionOfferV1> r
 
         LOGM(LOG, "Offer {:x} asks to send data from source {:x}", (uintptr_t)this, (uintptr_t)source.get());
 
-        source->send(mime, std::move(sendFd));
+        g_pSelectionCacheManager->send(source.lock(), mime, std::move(sendFd));
     });
 }
 
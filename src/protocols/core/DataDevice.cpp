@@ -1,6 +1,7 @@
 #include "DataDevice.hpp"
 #include <algorithm>
 #include "../../managers/SeatManager.hpp"
+#include "../../managers/SelectionCacheManager.hpp"
 #include "../../managers/PointerManager.hpp"
 #include "../../managers/eventLoop/EventLoopManager.hpp"
 #include "../../Compositor.hpp"
@@ -59,7 +60,7 @@ CWLDataOfferResource::CWLDataOfferResource(SP<CWlDataOffer> resource_, SP<IDataS
             m_source->accepted(mime ? mime : "");
         }
 
-        m_source->send(mime ? mime : "", std::move(sendFd));
+        g_pSelectionCacheManager->send(m_source.lock(), mime ? mime : "", std::move(sendFd));
 
         m_recvd = true;
 
@@ -814,7 +815,7 @@ void CWLDataDeviceProtocol::renderDND(PHLMONITOR pMonitor, const Time::steady_tp
     CTexPassElement::SRenderData data;
     data.tex = m_dnd.dndSurface->m_current.texture;
     data.box = box;
-    g_pHyprRenderer->m_sRenderPass.add(makeShared<CTexPassElement>(data));
+    g_pHyprRenderer->m_sRenderPass.emplace<CTexPassElement>(data);
 
     CBox damageBox = CBox{surfacePos, m_dnd.dndSurface->m_current.size}.expand(5);
     g_pHyprRenderer->damageBox(damageBox);
@@ -0,0 +1,177 @@
+#include "FrameScheduler.hpp"
+#include "Renderer.hpp"
+#include "../Compositor.hpp"
+#include "../config/ConfigValue.hpp"
+#include "../desktop/Window.hpp"
+#include "../debug/FrameMetrics.hpp"
+#include "../managers/eventLoop/EventLoopManager.hpp"
+#include "../protocols/types/ContentType.hpp"
+#include <algorithm>
+
+using enum NContentType::eContentType;
+
+CFrameScheduler::CFrameScheduler(PHLMONITOR monitor) : m_monitor(monitor) {
+    m_timer = makeShared<CEventLoopTimer>(std::nullopt, [this](SP<CEventLoopTimer> self, void* data) { renderDeferred(); }, nullptr);
+    g_pEventLoopManager->addTimer(m_timer);
+}
+
+CFrameScheduler::~CFrameScheduler() {
+    if (g_pEventLoopManager)
+        g_pEventLoopManager->removeTimer(m_timer);
+}
+
+bool CFrameScheduler::shouldDefer() {
+    static auto PMODE = CConfigValue<Hyprlang::INT>("render:frame_scheduling");
+
+    const auto  PMONITOR = m_monitor.lock();
+
+    if (*PMODE == FRAME_SCHEDULING_OFF || !PMONITOR || !PMONITOR->m_activeWorkspace)
+        return false;
+
+    // with VRR the next vblank moves with us, waiting would just lower the refresh rate
+    if (PMONITOR->m_output->state->state().adaptiveSync || PMONITOR->m_tearingState.activelyTearing)
+        return false;
+
+    auto PWINDOW = PMONITOR->m_solitaryClient.lock();
+    if (!PWINDOW)
+        PWINDOW = PMONITOR->m_activeWorkspace->getFullscreenWindow();
+
+    if (!PWINDOW)
+        return *PMODE == FRAME_SCHEDULING_ALWAYS;
+
+    const auto CONTENTTYPE = PWINDOW->getContentType();
+
+    // video is paced by its own clock, freshness gains nothing there and a missed vblank is a visible stutter
+    if (CONTENTTYPE == CONTENT_TYPE_VIDEO)
+        return false;
+
+    return *PMODE == FRAME_SCHEDULING_ALWAYS || CONTENTTYPE == CONTENT_TYPE_GAME;
+}
+
+float CFrameScheduler::refreshIntervalUs() {
+    const auto PMONITOR = m_monitor.lock();
+    return PMONITOR && PMONITOR->m_refreshRate > 0 ? 1000000.F / PMONITOR->m_refreshRate : 0.F;
+}
+
+std::optional<float> CFrameScheduler::predictedRenderUs() {
+    if (m_sampleCount < MIN_SAMPLES)
+        return std::nullopt;
+
+    std::array<float, RENDER_SAMPLES> sorted = m_samples;
+    const auto                        END    = sorted.begin() + m_sampleCount;
+    const auto                        NTH    = sorted.begin() + (size_t)((m_sampleCount - 1) * PREDICT_PERCENTILE);
+
+    std::nth_element(sorted.begin(), NTH, END);
+
+    return *NTH;
+}
+
+bool CFrameScheduler::onFrame() {
+    const auto NOW = Time::steadyNow();
+
+    // the present of a deferred frame comes before the next frame event, anything later is not ours to judge
+    m_awaitingPresent = false;
+
+    if (m_pending) {
+        // we got asked again before the deferred render ran, don't sit on it any longer
+        cancel();
+        return false;
+    }
+
+    if (!shouldDefer())
+        return false;
+
+    const auto PREDICTED = predictedRenderUs();
+    const auto INTERVAL  = refreshIntervalUs();
+
+    if (!PREDICTED || INTERVAL <= 0.F || *PREDICTED + m_marginUs >= INTERVAL)
+        return false;
+
+    // the frame event fires right on the page flip, if we have a fresh presentation timestamp prefer it
+    auto vblank = NOW;
+    if (m_hasPresent && NOW >= m_lastPresent && NOW - m_lastPresent < std::chrono::microseconds((int64_t)INTERVAL))
+        vblank = m_lastPresent;
+
+    const auto TARGET   = vblank + std::chrono::microseconds((int64_t)INTERVAL);
+    const auto RENDERAT = TARGET - std::chrono::microseconds((int64_t)(*PREDICTED + m_marginUs));
+
+    if (RENDERAT <= NOW + std::chrono::microseconds((int64_t)MIN_DEFER_US))
+        return false;
+
+    m_frameRequested = NOW;
+    m_targetPresent  = TARGET;
+    m_pending        = true;
+    m_timer->updateTimeout(RENDERAT - NOW);
+
+    return true;
+}
+
+void CFrameScheduler::renderDeferred() {
+    if (!m_pending)
+        return;
+
+    m_pending = false;
+
+    const auto PMONITOR = m_monitor.lock();
+
+    // the vt may have been switched away or the monitor disabled since the frame was deferred
+    if (!PMONITOR || !PMONITOR->prepareFrame())
+        return;
+
+    g_pFrameMetrics->onScheduled(PMONITOR, std::chrono::duration_cast<std::chrono::microseconds>(Time::steadyNow() - m_frameRequested).count());
+
+    m_awaitingPresent = true;
+    g_pHyprRenderer->renderMonitor(PMONITOR);
+}
+
+void CFrameScheduler::onRendered(float durationUs) {
+    m_samples[m_nextSample] = durationUs;
+    m_nextSample            = (m_nextSample + 1) % RENDER_SAMPLES;
+    m_sampleCount           = std::min(m_sampleCount + 1, RENDER_SAMPLES);
+
+    // rendered through some other path in the meantime, the deferred one would be a duplicate
+    if (m_pending)
+        cancel();
+}
+
+void CFrameScheduler::onPresented(const Time::steady_tp& when) {
+    if (m_awaitingPresent) {
+        m_awaitingPresent = false;
+
+        const auto INTERVAL = std::chrono::microseconds((int64_t)refreshIntervalUs());
+
+        // only judge presents that plausibly belong to the deferred frame, a skipped commit would make the next one look late
+        if (when < m_targetPresent + INTERVAL * 2) {
+            if (when > m_targetPresent + INTERVAL / 2) {
+                m_marginUs = std::min(m_marginUs + MISS_PENALTY_US, MAX_MARGIN_US);
+                Debug::log(TRACE, "FrameScheduler: deferred frame missed its vblank by {}us, margin now {:.0f}us",
+                           std::chrono::duration_cast<std::chrono::microseconds>(when - m_targetPresent).count(), m_marginUs);
+            } else
+                m_marginUs = std::max(m_marginUs - HIT_DECAY_US, BASE_MARGIN_US);
+        }
+    }
+
+    m_lastPresent = when;
+    m_hasPresent  = true;
+}
+
+void CFrameScheduler::cancel() {
+    m_pending = false;
+    m_timer->updateTimeout(std::nullopt);
+}
+
+Time::steady_tp CFrameScheduler::renderDeadline() {
+    const auto NOW      = Time::steadyNow();
+    const auto INTERVAL = std::chrono::microseconds((int64_t)refreshIntervalUs());
+
+    if (!m_hasPresent || INTERVAL.count() <= 0 || NOW < m_lastPresent)
+        return NOW;
+
+    const auto VBLANK = m_lastPresent + INTERVAL * ((NOW - m_lastPresent) / INTERVAL + 1);
+
+    return VBLANK - std::chrono::microseconds((int64_t)(predictedRenderUs().value_or(0.F) + m_marginUs));
+}
+
+bool CFrameScheduler::pending() {
+    return m_pending;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <array>
+#include <optional>
+#include "../defines.hpp"
+#include "../helpers/time/Time.hpp"
+
+class CEventLoopTimer;
+
+enum eFrameSchedulingMode : uint8_t {
+    FRAME_SCHEDULING_OFF = 0,
+    FRAME_SCHEDULING_ALWAYS,
+    FRAME_SCHEDULING_AUTO, // only for a fullscreen or solitary client with content type game
+};
+
+/*
+    Predictive frame scheduling: instead of rendering as soon as the output asks for a frame,
+    wait until just before the next vblank minus the predicted render time. The frame then
+    samples the newest client buffers and input instead of ones a whole refresh old.
+
+    The prediction is a high percentile over this monitor's last RENDER_SAMPLES render times,
+    plus a safety margin that grows whenever a deferred frame misses its vblank and slowly
+    decays back while we keep hitting it.
+*/
+class CFrameScheduler {
+  public:
+    CFrameScheduler(PHLMONITOR monitor);
+    ~CFrameScheduler();
+
+    // on the output frame event. True if rendering was deferred, false if the caller should render now.
+    bool onFrame();
+    void onRendered(float durationUs);
+    void onPresented(const Time::steady_tp& when);
+
+    // drops a pending deferred render
+    void cancel();
+    bool pending();
+
+    // latest point rendering can start and still make the next vblank
+    Time::steady_tp renderDeadline();
+
+  private:
+    bool                              shouldDefer();
+    std::optional<float>              predictedRenderUs();
+    float                             refreshIntervalUs();
+    void                              renderDeferred();
+
+    static constexpr size_t           RENDER_SAMPLES     = 32;
+    static constexpr size_t           MIN_SAMPLES        = 8;
+    static constexpr float            PREDICT_PERCENTILE = 0.9F;
+    static constexpr float            BASE_MARGIN_US     = 1000.F; // commit + kernel + scanout setup
+    static constexpr float            MAX_MARGIN_US      = 6000.F;
+    static constexpr float            MISS_PENALTY_US    = 500.F;
+    static constexpr float            HIT_DECAY_US       = 25.F;
+    static constexpr float            MIN_DEFER_US       = 200.F; // not worth a timer wakeup below this
+
+    PHLMONITORREF                     m_monitor;
+    SP<CEventLoopTimer>               m_timer;
+
+    std::array<float, RENDER_SAMPLES> m_samples     = {};
+    size_t                            m_sampleCount = 0;
+    size_t                            m_nextSample  = 0;
+    float                             m_marginUs    = BASE_MARGIN_US;
+
+    Time::steady_tp                   m_lastPresent;
+    Time::steady_tp                   m_frameRequested; // frame event the pending render answers
+    Time::steady_tp                   m_targetPresent;  // vblank the deferred frame aims for
+    bool                              m_hasPresent      = false;
+    bool                              m_pending         = false;
+    bool                              m_awaitingPresent = false; // a deferred frame was committed, check it made its vblank
+};
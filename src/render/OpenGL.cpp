@@ -2,6 +2,7 @@
 #include <hyprgraphics/color/Color.hpp>
 #include <hyprutils/string/String.hpp>
 #include <hyprutils/path/Path.hpp>
+#include <mutex>
 #include <random>
 #include <pango/pangocairo.h>
 #include "OpenGL.hpp"
@@ -18,7 +19,9 @@
 #include "../managers/HookSystemManager.hpp"
 #include "../managers/input/InputManager.hpp"
 #include "../helpers/fs/FsUtils.hpp"
+#include "../helpers/StartupTasks.hpp"
 #include "debug/HyprNotificationOverlay.hpp"
+#include "debug/FrameTracer.hpp"
 #include "hyprerror/HyprError.hpp"
 #include "pass/TexPassElement.hpp"
 #include "pass/RectPassElement.hpp"
@@ -343,6 +346,8 @@ CHyprOpenGLImpl::CHyprOpenGLImpl() : m_iDRMFD(g_pCompositor->m_drmFD) {
     Debug::log(LOG, "Renderer: {}", (char*)glGetString(GL_RENDERER));
     Debug::log(LOG, "Supported extensions: ({}) {}", std::count(m_szExtensions.begin(), m_szExtensions.end(), ' '), m_szExtensions);
 
+    m_shaderCache.init();
+
     m_sExts.EXT_read_format_bgra = m_szExtensions.contains("GL_EXT_read_format_bgra");
 
     RASSERT(m_szExtensions.contains("GL_EXT_texture_format_BGRA8888"), "GL_EXT_texture_format_BGRA8888 support by the GPU driver is required");
@@ -601,6 +606,9 @@ void CHyprOpenGLImpl::logShaderError(const GLuint& shader, bool program, bool si
 }
 
 GLuint CHyprOpenGLImpl::createProgram(const std::string& vert, const std::string& frag, bool dynamic, bool silent) {
+    if (const auto CACHED = m_shaderCache.load(vert, frag); CACHED)
+        return CACHED;
+
     auto vertCompiled = compileShader(GL_VERTEX_SHADER, vert, dynamic, silent);
     if (dynamic) {
         if (vertCompiled == 0)
@@ -618,6 +626,8 @@ GLuint CHyprOpenGLImpl::createProgram(const std::string& vert, const std::string
     auto prog = glCreateProgram();
     glAttachShader(prog, vertCompiled);
     glAttachShader(prog, fragCompiled);
+    if (m_shaderCache.enabled())
+        glProgramParameteri(prog, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
     glLinkProgram(prog);
 
     glDetachShader(prog, vertCompiled);
@@ -638,6 +648,8 @@ GLuint CHyprOpenGLImpl::createProgram(const std::string& vert, const std::string
         RASSERT(ok != GL_FALSE, "createProgram() failed! GL_LINK_STATUS not OK!");
     }
 
+    m_shaderCache.store(prog, vert, frag);
+
     return prog;
 }
 
@@ -738,6 +750,8 @@ void CHyprOpenGLImpl::begin(PHLMONITOR pMonitor, const CRegion& damage_, CFrameb
 
     TRACY_GPU_ZONE("RenderBegin");
 
+    m_sDrawStats = {};
+
     glViewport(0, 0, pMonitor->m_pixelSize.x, pMonitor->m_pixelSize.y);
 
     m_RenderData.projection = Mat3x3::outputProjection(pMonitor->m_pixelSize, HYPRUTILS_TRANSFORM_NORMAL);
@@ -933,6 +947,9 @@ bool CHyprOpenGLImpl::initShaders() {
     auto              shaders   = makeShared<SPreparedShaders>();
     const bool        isDynamic = m_bShadersInitialized;
     static const auto PCM       = CConfigValue<Hyprlang::INT>("render:cm_enabled");
+    const auto        BEGIN     = Time::steadyNow();
+
+    m_shaderCache.resetStats();
 
     try {
         std::map<std::string, std::string> includes;
@@ -1190,7 +1207,8 @@ bool CHyprOpenGLImpl::initShaders() {
     m_shaders             = shaders;
     m_bShadersInitialized = true;
 
-    Debug::log(LOG, "Shaders initialized successfully.");
+    Debug::log(LOG, "Shaders initialized successfully in {:.2f}ms ({} from cache, {} compiled).",
+               std::chrono::duration_cast<std::chrono::microseconds>(Time::steadyNow() - BEGIN).count() / 1000.F, m_shaderCache.hits, m_shaderCache.misses);
     g_pHyprError->destroy();
     return true;
 }
@@ -1308,6 +1326,69 @@ void CHyprOpenGLImpl::scissor(const int x, const int y, const int w, const int h
     scissor(box, transform);
 }
 
+void CHyprOpenGLImpl::drawArrays(GLenum mode, GLint first, GLsizei count) {
+    glDrawArrays(mode, first, count);
+    m_sDrawStats.drawCalls++;
+}
+
+void CHyprOpenGLImpl::drawQuadWithDamage(const CBox& box, const CRegion& damage, GLint posAttrib, GLint texAttrib) {
+    CRegion damageClip = damage;
+    if (m_RenderData.clipBox.width != 0 && m_RenderData.clipBox.height != 0)
+        damageClip.intersect(m_RenderData.clipBox);
+
+    if (damageClip.empty())
+        return;
+
+    const auto RECTS = damageClip.getRects();
+
+    // a rotated or transformed quad doesn't map damage rects onto sub-rects of itself, scissor every rect instead
+    if (box.rot != 0 || (m_bEndFrame && m_RenderData.pMonitor->m_transform != WL_OUTPUT_TRANSFORM_NORMAL)) {
+        glVertexAttribPointer(posAttrib, 2, GL_FLOAT, GL_FALSE, 0, fullVerts);
+        if (texAttrib != -1)
+            glVertexAttribPointer(texAttrib, 2, GL_FLOAT, GL_FALSE, 0, fullVerts);
+
+        for (auto const& RECT : RECTS) {
+            scissor(&RECT);
+            drawArrays(GL_TRIANGLE_STRIP, 0, 4);
+        }
+
+        scissor(nullptr);
+        return;
+    }
+
+    // every damage rect clipped to the quad, in the quad's own 0-1 space. Rects share exact edges, so nothing is covered twice.
+    m_vDamageQuadVerts.clear();
+    for (auto const& RECT : RECTS) {
+        const double X1 = std::max<double>(RECT.x1, box.x);
+        const double Y1 = std::max<double>(RECT.y1, box.y);
+        const double X2 = std::min<double>(RECT.x2, box.x + box.width);
+        const double Y2 = std::min<double>(RECT.y2, box.y + box.height);
+
+        if (X2 <= X1 || Y2 <= Y1)
+            continue;
+
+        const float U1 = (X1 - box.x) / box.width;
+        const float V1 = (Y1 - box.y) / box.height;
+        const float U2 = (X2 - box.x) / box.width;
+        const float V2 = (Y2 - box.y) / box.height;
+
+        m_vDamageQuadVerts.insert(m_vDamageQuadVerts.end(), {U1, V1, U2, V1, U1, V2, U2, V1, U2, V2, U1, V2});
+    }
+
+    if (m_vDamageQuadVerts.empty())
+        return;
+
+    glVertexAttribPointer(posAttrib, 2, GL_FLOAT, GL_FALSE, 0, m_vDamageQuadVerts.data());
+    if (texAttrib != -1)
+        glVertexAttribPointer(texAttrib, 2, GL_FLOAT, GL_FALSE, 0, m_vDamageQuadVerts.data());
+
+    scissor(nullptr);
+
+    const GLsizei VERTS = m_vDamageQuadVerts.size() / 2;
+    drawArrays(GL_TRIANGLES, 0, VERTS);
+    m_sDrawStats.drawsSaved += VERTS / 6 - 1;
+}
+
 void CHyprOpenGLImpl::renderRect(const CBox& box, const CHyprColor& col, int round, float roundingPower) {
     if (!m_RenderData.damage.empty())
         renderRectWithDamage(box, col, m_RenderData.damage, round, roundingPower);
@@ -1398,26 +1479,9 @@ void CHyprOpenGLImpl::renderRectWithDamage(const CBox& box, const CHyprColor& co
     glUniform1f(m_shaders->m_shQUAD.radius, round);
     glUniform1f(m_shaders->m_shQUAD.roundingPower, roundingPower);
 
-    glVertexAttribPointer(m_shaders->m_shQUAD.posAttrib, 2, GL_FLOAT, GL_FALSE, 0, fullVerts);
-
     glEnableVertexAttribArray(m_shaders->m_shQUAD.posAttrib);
 
-    if (m_RenderData.clipBox.width != 0 && m_RenderData.clipBox.height != 0) {
-        CRegion damageClip{m_RenderData.clipBox.x, m_RenderData.clipBox.y, m_RenderData.clipBox.width, m_RenderData.clipBox.height};
-        damageClip.intersect(damage);
-
-        if (!damageClip.empty()) {
-            for (auto const& RECT : damageClip.getRects()) {
-                scissor(&RECT);
-                glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-            }
-        }
-    } else {
-        for (auto const& RECT : damage.getRects()) {
-            scissor(&RECT);
-            glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-        }
-    }
+    drawQuadWithDamage(newBox, damage, m_shaders->m_shQUAD.posAttrib);
 
     glDisableVertexAttribArray(m_shaders->m_shQUAD.posAttrib);
 
@@ -1683,13 +1747,13 @@ void CHyprOpenGLImpl::renderTextureInternalWithDamage(SP<CTexture> tex, const CB
         if (!damageClip.empty()) {
             for (auto const& RECT : damageClip.getRects()) {
                 scissor(&RECT);
-                glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+                drawArrays(GL_TRIANGLE_STRIP, 0, 4);
             }
         }
     } else {
         for (auto const& RECT : damage.getRects()) {
             scissor(&RECT);
-            glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+            drawArrays(GL_TRIANGLE_STRIP, 0, 4);
         }
     }
 
@@ -1739,7 +1803,7 @@ void CHyprOpenGLImpl::renderTexturePrimitive(SP<CTexture> tex, const CBox& box)
 
     for (auto const& RECT : m_RenderData.damage.getRects()) {
         scissor(&RECT);
-        glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+        drawArrays(GL_TRIANGLE_STRIP, 0, 4);
     }
 
     scissor(nullptr);
@@ -1795,7 +1859,7 @@ void CHyprOpenGLImpl::renderTextureMatte(SP<CTexture> tex, const CBox& box, CFra
 
     for (auto const& RECT : m_RenderData.damage.getRects()) {
         scissor(&RECT);
-        glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+        drawArrays(GL_TRIANGLE_STRIP, 0, 4);
     }
 
     scissor(nullptr);
@@ -1818,6 +1882,7 @@ CFramebuffer* CHyprOpenGLImpl::blurMainFramebufferWithDamage(float a, CRegion* o
     }
 
     TRACY_GPU_ZONE("RenderBlurMainFramebufferWithDamage");
+    TRACE_SCOPE("blur", TRACE_CATEGORY_RENDER, "monitor", m_RenderData.pMonitor->m_id);
 
     const auto BLENDBEFORE = m_bBlend;
     blend(false);
@@ -1901,7 +1966,7 @@ CFramebuffer* CHyprOpenGLImpl::blurMainFramebufferWithDamage(float a, CRegion* o
         if (!damage.empty()) {
             for (auto const& RECT : damage.getRects()) {
                 scissor(&RECT, false /* this region is already transformed */);
-                glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+                drawArrays(GL_TRIANGLE_STRIP, 0, 4);
             }
         }
 
@@ -1954,7 +2019,7 @@ CFramebuffer* CHyprOpenGLImpl::blurMainFramebufferWithDamage(float a, CRegion* o
         if (!pDamage->empty()) {
             for (auto const& RECT : pDamage->getRects()) {
                 scissor(&RECT, false /* this region is already transformed */);
-                glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+                drawArrays(GL_TRIANGLE_STRIP, 0, 4);
             }
         }
 
@@ -2026,7 +2091,7 @@ CFramebuffer* CHyprOpenGLImpl::blurMainFramebufferWithDamage(float a, CRegion* o
         if (!damage.empty()) {
             for (auto const& RECT : damage.getRects()) {
                 scissor(&RECT, false /* this region is already transformed */);
-                glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+                drawArrays(GL_TRIANGLE_STRIP, 0, 4);
             }
         }
 
@@ -2079,7 +2144,7 @@ void CHyprOpenGLImpl::preRender(PHLMONITOR pMonitor) {
 
         const auto  PSURFACE = pWindow->m_wlSurface->resource();
 
-        const auto  PWORKSPACE = pWindow->m_workspace;
+        const auto  PWORKSPACE = pWindow->workspace();
         const float A          = pWindow->m_alpha->value() * pWindow->m_activeInactiveAlpha->value() * PWORKSPACE->m_alpha->value();
 
         if (A >= 1.f) {
@@ -2100,15 +2165,18 @@ void CHyprOpenGLImpl::preRender(PHLMONITOR pMonitor) {
     };
 
     bool hasWindows = false;
-    for (auto const& w : g_pCompositor->m_windows) {
-        if (w->m_workspace == pMonitor->m_activeWorkspace && !w->isHidden() && w->m_isMapped && (!w->m_isFloating || *PBLURXRAY)) {
+    if (pMonitor->m_activeWorkspace) {
+        for (auto const& ref : pMonitor->m_activeWorkspace->windows()) {
+            const auto w = ref.lock();
+            if (w && !w->isHidden() && w->m_isMapped && (!w->m_isFloating || *PBLURXRAY)) {
 
-            // check if window is valid
-            if (!windowShouldBeBlurred(w))
-                continue;
+                // check if window is valid
+                if (!windowShouldBeBlurred(w))
+                    continue;
 
-            hasWindows = true;
-            break;
+                hasWindows = true;
+                break;
+            }
         }
     }
 
@@ -2170,7 +2238,7 @@ void CHyprOpenGLImpl::preWindowPass() {
     if (!preBlurQueued())
         return;
 
-    g_pHyprRenderer->m_sRenderPass.add(makeShared<CPreBlurElement>());
+    g_pHyprRenderer->m_sRenderPass.emplace<CPreBlurElement>();
 }
 
 bool CHyprOpenGLImpl::preBlurQueued() {
@@ -2383,28 +2451,10 @@ void CHyprOpenGLImpl::renderBorder(const CBox& box, const CGradientValueData& gr
     glUniform1f(m_shaders->m_shBORDER1.roundingPower, roundingPower);
     glUniform1f(m_shaders->m_shBORDER1.thick, scaledBorderSize);
 
-    glVertexAttribPointer(m_shaders->m_shBORDER1.posAttrib, 2, GL_FLOAT, GL_FALSE, 0, fullVerts);
-    glVertexAttribPointer(m_shaders->m_shBORDER1.texAttrib, 2, GL_FLOAT, GL_FALSE, 0, fullVerts);
-
     glEnableVertexAttribArray(m_shaders->m_shBORDER1.posAttrib);
     glEnableVertexAttribArray(m_shaders->m_shBORDER1.texAttrib);
 
-    if (m_RenderData.clipBox.width != 0 && m_RenderData.clipBox.height != 0) {
-        CRegion damageClip{m_RenderData.clipBox.x, m_RenderData.clipBox.y, m_RenderData.clipBox.width, m_RenderData.clipBox.height};
-        damageClip.intersect(m_RenderData.damage);
-
-        if (!damageClip.empty()) {
-            for (auto const& RECT : damageClip.getRects()) {
-                scissor(&RECT);
-                glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-            }
-        }
-    } else {
-        for (auto const& RECT : m_RenderData.damage.getRects()) {
-            scissor(&RECT);
-            glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-        }
-    }
+    drawQuadWithDamage(newBox, m_RenderData.damage, m_shaders->m_shBORDER1.posAttrib, m_shaders->m_shBORDER1.texAttrib);
 
     glDisableVertexAttribArray(m_shaders->m_shBORDER1.posAttrib);
     glDisableVertexAttribArray(m_shaders->m_shBORDER1.texAttrib);
@@ -2480,28 +2530,10 @@ void CHyprOpenGLImpl::renderBorder(const CBox& box, const CGradientValueData& gr
     glUniform1f(m_shaders->m_shBORDER1.roundingPower, roundingPower);
     glUniform1f(m_shaders->m_shBORDER1.thick, scaledBorderSize);
 
-    glVertexAttribPointer(m_shaders->m_shBORDER1.posAttrib, 2, GL_FLOAT, GL_FALSE, 0, fullVerts);
-    glVertexAttribPointer(m_shaders->m_shBORDER1.texAttrib, 2, GL_FLOAT, GL_FALSE, 0, fullVerts);
-
     glEnableVertexAttribArray(m_shaders->m_shBORDER1.posAttrib);
     glEnableVertexAttribArray(m_shaders->m_shBORDER1.texAttrib);
 
-    if (m_RenderData.clipBox.width != 0 && m_RenderData.clipBox.height != 0) {
-        CRegion damageClip{m_RenderData.clipBox.x, m_RenderData.clipBox.y, m_RenderData.clipBox.width, m_RenderData.clipBox.height};
-        damageClip.intersect(m_RenderData.damage);
-
-        if (!damageClip.empty()) {
-            for (auto const& RECT : damageClip.getRects()) {
-                scissor(&RECT);
-                glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-            }
-        }
-    } else {
-        for (auto const& RECT : m_RenderData.damage.getRects()) {
-            scissor(&RECT);
-            glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-        }
-    }
+    drawQuadWithDamage(newBox, m_RenderData.damage, m_shaders->m_shBORDER1.posAttrib, m_shaders->m_shBORDER1.texAttrib);
 
     glDisableVertexAttribArray(m_shaders->m_shBORDER1.posAttrib);
     glDisableVertexAttribArray(m_shaders->m_shBORDER1.texAttrib);
@@ -2561,28 +2593,10 @@ void CHyprOpenGLImpl::renderRoundedShadow(const CBox& box, int round, float roun
     glUniform1f(m_shaders->m_shSHADOW.range, range);
     glUniform1f(m_shaders->m_shSHADOW.shadowPower, SHADOWPOWER);
 
-    glVertexAttribPointer(m_shaders->m_shSHADOW.posAttrib, 2, GL_FLOAT, GL_FALSE, 0, fullVerts);
-    glVertexAttribPointer(m_shaders->m_shSHADOW.texAttrib, 2, GL_FLOAT, GL_FALSE, 0, fullVerts);
-
     glEnableVertexAttribArray(m_shaders->m_shSHADOW.posAttrib);
     glEnableVertexAttribArray(m_shaders->m_shSHADOW.texAttrib);
 
-    if (m_RenderData.clipBox.width != 0 && m_RenderData.clipBox.height != 0) {
-        CRegion damageClip{m_RenderData.clipBox.x, m_RenderData.clipBox.y, m_RenderData.clipBox.width, m_RenderData.clipBox.height};
-        damageClip.intersect(m_RenderData.damage);
-
-        if (!damageClip.empty()) {
-            for (auto const& RECT : damageClip.getRects()) {
-                scissor(&RECT);
-                glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-            }
-        }
-    } else {
-        for (auto const& RECT : m_RenderData.damage.getRects()) {
-            scissor(&RECT);
-            glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-        }
-    }
+    drawQuadWithDamage(newBox, m_RenderData.damage, m_shaders->m_shSHADOW.posAttrib, m_shaders->m_shSHADOW.texAttrib);
 
     glDisableVertexAttribArray(m_shaders->m_shSHADOW.posAttrib);
     glDisableVertexAttribArray(m_shaders->m_shSHADOW.texAttrib);
@@ -2623,7 +2637,7 @@ void CHyprOpenGLImpl::renderMirrored() {
     if (!PFB->isAllocated() || !PFB->getTexture())
         return;
 
-    g_pHyprRenderer->m_sRenderPass.add(makeShared<CClearPassElement>(CClearPassElement::SClearData{CHyprColor(0, 0, 0, 0)}));
+    g_pHyprRenderer->m_sRenderPass.emplace<CClearPassElement>(CClearPassElement::SClearData{CHyprColor(0, 0, 0, 0)});
 
     CTexPassElement::SRenderData data;
     data.tex               = PFB->getTexture();
@@ -2634,7 +2648,7 @@ void CHyprOpenGLImpl::renderMirrored() {
                                  .transform(wlTransformToHyprutils(invertTransform(mirrored->m_transform)))
                                  .translate(-monitor->m_transformedSize / 2.0);
 
-    g_pHyprRenderer->m_sRenderPass.add(makeShared<CTexPassElement>(data));
+    g_pHyprRenderer->m_sRenderPass.emplace<CTexPassElement>(data);
 }
 
 void CHyprOpenGLImpl::renderSplash(cairo_t* const CAIRO, cairo_surface_t* const CAIROSURFACE, double offsetY, const Vector2D& size) {
@@ -2672,31 +2686,121 @@ void CHyprOpenGLImpl::renderSplash(cairo_t* const CAIRO, cairo_surface_t* const
     cairo_surface_flush(CAIROSURFACE);
 }
 
-SP<CTexture> CHyprOpenGLImpl::loadAsset(const std::string& filename) {
+// PNGs decoded by the startup task, consumed by loadAsset
+static std::mutex                                        predecodedMutex;
+static std::unordered_map<std::string, cairo_surface_t*> predecodedAssets;
 
-    std::string fullPath;
+static std::string findAsset(const std::string& filename) {
     for (auto& e : ASSET_PATHS) {
         std::string     p = std::string{e} + "/hypr/" + filename;
         std::error_code ec;
-        if (std::filesystem::exists(p, ec)) {
-            fullPath = p;
-            break;
-        } else
+        if (std::filesystem::exists(p, ec))
+            return p;
+        else
             Debug::log(LOG, "loadAsset: looking at {} unsuccessful: ec {}", filename, ec.message());
     }
 
-    if (fullPath.empty()) {
-        failedAssetsNo++;
-        Debug::log(ERR, "loadAsset: looking for {} failed (no provider found)", filename);
-        return m_pMissingAssetTexture;
+    return "";
+}
+
+// rolled by startupAssets, so the first background load uses the wallpaper decoded at startup. Later loads roll again
+static std::optional<int64_t> startupRandomWallpaper;
+
+static int64_t                rollRandomWallpaper() {
+    std::mt19937_64                 engine(time(nullptr));
+    std::uniform_int_distribution<> distribution(0, 2);
+    return distribution(engine);
+}
+
+static std::string backgroundAssetName(bool forStartup = false) {
+    static auto PFORCEWALLPAPER = CConfigValue<Hyprlang::INT>("misc:force_default_wallpaper");
+
+    const auto  FORCEWALLPAPER = std::clamp(*PFORCEWALLPAPER, static_cast<int64_t>(-1L), static_cast<int64_t>(2L));
+
+    if (FORCEWALLPAPER != -1)
+        return std::format("wall{}.png", FORCEWALLPAPER);
+
+    int64_t random = 0;
+    if (forStartup)
+        random = *(startupRandomWallpaper = rollRandomWallpaper());
+    else if (startupRandomWallpaper) {
+        random = *startupRandomWallpaper;
+        startupRandomWallpaper.reset();
+    } else
+        random = rollRandomWallpaper();
+
+    return std::format("wall{}.png", random);
+}
+
+std::vector<std::string> CHyprOpenGLImpl::startupAssets() {
+    static auto              PNOWALLPAPER = CConfigValue<Hyprlang::INT>("misc:disable_hyprland_logo");
+
+    std::vector<std::string> assets = {"lockdead.png", "lockdead2.png"};
+    if (!*PNOWALLPAPER)
+        assets.emplace_back(backgroundAssetName(true));
+
+    return assets;
+}
+
+void CHyprOpenGLImpl::predecodeAssets(const std::vector<std::string>& files) {
+    for (auto const& f : files) {
+        const auto PATH = findAsset(f);
+        if (PATH.empty())
+            continue;
+
+        const auto CAIROSURFACE = cairo_image_surface_create_from_png(PATH.c_str());
+        if (cairo_surface_status(CAIROSURFACE) != CAIRO_STATUS_SUCCESS) {
+            cairo_surface_destroy(CAIROSURFACE);
+            continue;
+        }
+
+        std::lock_guard<std::mutex> lg(predecodedMutex);
+        predecodedAssets[f] = CAIROSURFACE;
     }
+}
 
-    const auto CAIROSURFACE = cairo_image_surface_create_from_png(fullPath.c_str());
+void CHyprOpenGLImpl::warmUpFonts() {
+    // loading the fontconfig cache is what makes the first renderText slow
+    auto* const       FONTMAP  = pango_cairo_font_map_new();
+    PangoFontFamily** families = nullptr;
+    int               count    = 0;
+
+    pango_font_map_list_families(FONTMAP, &families, &count);
+
+    g_free(families);
+    g_object_unref(FONTMAP);
+}
+
+SP<CTexture> CHyprOpenGLImpl::loadAsset(const std::string& filename) {
+    if (g_pStartupTasks)
+        g_pStartupTasks->wait("assets");
+
+    cairo_surface_t* CAIROSURFACE = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lg(predecodedMutex);
+        if (const auto IT = predecodedAssets.find(filename); IT != predecodedAssets.end()) {
+            CAIROSURFACE = IT->second;
+            predecodedAssets.erase(IT);
+        }
+    }
 
     if (!CAIROSURFACE) {
-        failedAssetsNo++;
-        Debug::log(ERR, "loadAsset: failed to load {} (corrupt / inaccessible / not png)", fullPath);
-        return m_pMissingAssetTexture;
+        const auto FULLPATH = findAsset(filename);
+
+        if (FULLPATH.empty()) {
+            failedAssetsNo++;
+            Debug::log(ERR, "loadAsset: looking for {} failed (no provider found)", filename);
+            return m_pMissingAssetTexture;
+        }
+
+        CAIROSURFACE = cairo_image_surface_create_from_png(FULLPATH.c_str());
+
+        if (!CAIROSURFACE) {
+            failedAssetsNo++;
+            Debug::log(ERR, "loadAsset: failed to load {} (corrupt / inaccessible / not png)", FULLPATH);
+            return m_pMissingAssetTexture;
+        }
     }
 
     const auto CAIROFORMAT = cairo_image_surface_get_format(CAIROSURFACE);
@@ -2871,32 +2975,23 @@ void CHyprOpenGLImpl::initAssets() {
     m_pScreencopyDeniedTexture = renderText("Permission denied to share screen", Colors::WHITE, 20);
 
     ensureBackgroundTexturePresence();
+
+    // anything predecoded but not used by now (e.g. the config changed the wallpaper) won't be
+    std::lock_guard<std::mutex> lg(predecodedMutex);
+    for (auto const& [name, surface] : predecodedAssets) {
+        cairo_surface_destroy(surface);
+    }
+    predecodedAssets.clear();
 }
 
 void CHyprOpenGLImpl::ensureBackgroundTexturePresence() {
-    static auto PNOWALLPAPER    = CConfigValue<Hyprlang::INT>("misc:disable_hyprland_logo");
-    static auto PFORCEWALLPAPER = CConfigValue<Hyprlang::INT>("misc:force_default_wallpaper");
-
-    const auto  FORCEWALLPAPER = std::clamp(*PFORCEWALLPAPER, static_cast<int64_t>(-1L), static_cast<int64_t>(2L));
+    static auto PNOWALLPAPER = CConfigValue<Hyprlang::INT>("misc:disable_hyprland_logo");
 
     if (*PNOWALLPAPER)
         m_pBackgroundTexture.reset();
     else if (!m_pBackgroundTexture) {
         // create the default background texture
-        std::string texPath = "wall";
-
-        // get the adequate tex
-        if (FORCEWALLPAPER == -1) {
-            std::mt19937_64                 engine(time(nullptr));
-            std::uniform_int_distribution<> distribution(0, 2);
-
-            texPath += std::to_string(distribution(engine));
-        } else
-            texPath += std::to_string(std::clamp(*PFORCEWALLPAPER, (int64_t)0, (int64_t)2));
-
-        texPath += ".png";
-
-        m_pBackgroundTexture = loadAsset(texPath);
+        m_pBackgroundTexture = loadAsset(backgroundAssetName());
     }
 }
 
@@ -3010,7 +3105,7 @@ void CHyprOpenGLImpl::clearWithTex() {
         data.box          = {0, 0, m_RenderData.pMonitor->m_transformedSize.x, m_RenderData.pMonitor->m_transformedSize.y};
         data.flipEndFrame = true;
         data.tex          = TEXIT->second.getTexture();
-        g_pHyprRenderer->m_sRenderPass.add(makeShared<CTexPassElement>(data));
+        g_pHyprRenderer->m_sRenderPass.emplace<CTexPassElement>(data);
     }
 }
 
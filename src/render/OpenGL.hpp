@@ -16,6 +16,7 @@
 #include <cairo/cairo.h>
 
 #include "Shader.hpp"
+#include "ShaderCache.hpp"
 #include "Texture.hpp"
 #include "Framebuffer.hpp"
 #include "Renderbuffer.hpp"
@@ -228,6 +229,12 @@ class CHyprOpenGLImpl {
     void bindBackOnMain();
 
     SP<CTexture> loadAsset(const std::string& file);
+
+    // startup helpers, safe to call before the renderer exists and off the main thread (except startupAssets)
+    static std::vector<std::string> startupAssets();
+    static void                     predecodeAssets(const std::vector<std::string>& files);
+    static void                     warmUpFonts();
+
     SP<CTexture> renderText(const std::string& text, CHyprColor col, int pt, bool italic = false, const std::string& fontFamily = "", int maxWidth = 0, int weight = 400);
 
     void         setDamage(const CRegion& damage, std::optional<CRegion> finalDamage = {});
@@ -287,6 +294,12 @@ class CHyprOpenGLImpl {
 
     SP<CTexture> m_pScreencopyDeniedTexture;
 
+    // since the last begin(): draw calls issued, and how many more a scissored draw per damage rect would have taken
+    struct {
+        size_t drawCalls  = 0;
+        size_t drawsSaved = 0;
+    } m_sDrawStats;
+
   private:
     enum eEGLContextVersion : uint8_t {
         EGL_CONTEXT_GLES_2_0 = 0,
@@ -300,6 +313,7 @@ class CHyprOpenGLImpl {
     std::list<GLuint>       m_lTextures;
 
     std::vector<SDRMFormat> drmFormats;
+    std::vector<float>      m_vDamageQuadVerts; // reused by drawQuadWithDamage
     bool                    m_bHasModifiers = false;
 
     int                     m_iDRMFD = -1;
@@ -313,6 +327,7 @@ class CHyprOpenGLImpl {
     bool                    m_bCMSupported          = true;
 
     CShader                 m_sFinalScreenShader;
+    CShaderCache            m_shaderCache;
     CTimer                  m_tGlobalTimer;
 
     SP<CTexture>            m_pMissingAssetTexture, m_pBackgroundTexture, m_pLockDeadTexture, m_pLockDead2Texture, m_pLockTtyTextTexture; // TODO: don't always load lock
@@ -339,6 +354,9 @@ class CHyprOpenGLImpl {
     void renderTextureInternalWithDamage(SP<CTexture>, const CBox& box, float a, const CRegion& damage, int round = 0, float roundingPower = 2.0f, bool discardOpaque = false,
                                          bool noAA = false, bool allowCustomUV = false, bool allowDim = false);
     void renderTexturePrimitive(SP<CTexture> tex, const CBox& box);
+    void drawArrays(GLenum mode, GLint first, GLsizei count);
+    // draws the unit quad projected onto box, restricted to damage (and the clip box) in one call
+    void drawQuadWithDamage(const CBox& box, const CRegion& damage, GLint posAttrib, GLint texAttrib = -1);
     void renderSplash(cairo_t* const, cairo_surface_t* const, double offset, const Vector2D& size);
 
     void preBlurForCurrentMonitor();
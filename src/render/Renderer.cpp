@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <aquamarine/output/Output.hpp>
 #include <filesystem>
+#include <ranges>
 #include "../config/ConfigValue.hpp"
 #include "../config/ConfigManager.hpp"
 #include "../managers/CursorManager.hpp"
@@ -26,6 +27,10 @@
 #include "../hyprerror/HyprError.hpp"
 #include "../debug/HyprDebugOverlay.hpp"
 #include "../debug/HyprNotificationOverlay.hpp"
+#include "../debug/FrameTracer.hpp"
+#include "../debug/FrameMetrics.hpp"
+#include "../helpers/StartupTasks.hpp"
+#include "FrameScheduler.hpp"
 #include "pass/TexPassElement.hpp"
 #include "pass/ClearPassElement.hpp"
 #include "pass/RectPassElement.hpp"
@@ -172,21 +177,21 @@ bool CHyprRenderer::shouldRenderWindow(PHLWINDOW pWindow, PHLMONITOR pMonitor) {
     if (!pWindow->visibleOnMonitor(pMonitor))
         return false;
 
-    if (!pWindow->m_workspace && !pWindow->m_fadingOut)
+    if (!pWindow->workspace() && !pWindow->m_fadingOut)
         return false;
 
-    if (!pWindow->m_workspace && pWindow->m_fadingOut)
+    if (!pWindow->workspace() && pWindow->m_fadingOut)
         return pWindow->workspaceID() == pMonitor->activeWorkspaceID();
 
     if (pWindow->m_pinned)
         return true;
 
     // if the window is being moved to a workspace that is not invisible, and the alpha is > 0.F, render it.
-    if (pWindow->m_monitorMovedFrom != -1 && pWindow->m_movingToWorkspaceAlpha->isBeingAnimated() && pWindow->m_movingToWorkspaceAlpha->value() > 0.F && pWindow->m_workspace &&
-        !pWindow->m_workspace->isVisible())
+    if (pWindow->m_monitorMovedFrom != -1 && pWindow->m_movingToWorkspaceAlpha->isBeingAnimated() && pWindow->m_movingToWorkspaceAlpha->value() > 0.F && pWindow->workspace() &&
+        !pWindow->workspace()->isVisible())
         return true;
 
-    const auto PWINDOWWORKSPACE = pWindow->m_workspace;
+    const auto PWINDOWWORKSPACE = pWindow->workspace();
     if (PWINDOWWORKSPACE && PWINDOWWORKSPACE->m_monitor == pMonitor) {
         if (PWINDOWWORKSPACE->m_renderOffset->isBeingAnimated() || PWINDOWWORKSPACE->m_alpha->isBeingAnimated() || PWINDOWWORKSPACE->m_forceRendering)
             return true;
@@ -202,14 +207,14 @@ bool CHyprRenderer::shouldRenderWindow(PHLWINDOW pWindow, PHLMONITOR pMonitor) {
     if (pWindow->m_monitor == pMonitor)
         return true;
 
-    if ((!pWindow->m_workspace || !pWindow->m_workspace->isVisible()) && pWindow->m_monitor != pMonitor)
+    if ((!pWindow->workspace() || !pWindow->workspace()->isVisible()) && pWindow->m_monitor != pMonitor)
         return false;
 
     // if not, check if it maybe is active on a different monitor.
-    if (pWindow->m_workspace && pWindow->m_workspace->isVisible() && pWindow->m_isFloating /* tiled windows can't be multi-ws */)
+    if (pWindow->workspace() && pWindow->workspace()->isVisible() && pWindow->m_isFloating /* tiled windows can't be multi-ws */)
         return !pWindow->isFullscreen(); // Do not draw fullscreen windows on other monitors
 
-    if (pMonitor->m_activeSpecialWorkspace == pWindow->m_workspace)
+    if (pMonitor->m_activeSpecialWorkspace == pWindow->workspace())
         return true;
 
     // if window is tiled and it's flying in, don't render on other mons (for slide)
@@ -239,9 +244,9 @@ bool CHyprRenderer::shouldRenderWindow(PHLWINDOW pWindow) {
     if (!validMapped(pWindow))
         return false;
 
-    const auto PWORKSPACE = pWindow->m_workspace;
+    const auto PWORKSPACE = pWindow->workspace();
 
-    if (!pWindow->m_workspace)
+    if (!pWindow->workspace())
         return false;
 
     if (pWindow->m_pinned || PWORKSPACE->m_forceRendering)
@@ -266,48 +271,44 @@ void CHyprRenderer::renderWorkspaceWindowsFullscreen(PHLMONITOR pMonitor, PHLWOR
 
     EMIT_HOOK_EVENT("render", RENDER_PRE_WINDOWS);
 
-    // loop over the tiled windows that are fading out
-    for (auto const& w : g_pCompositor->m_windows) {
-        if (!shouldRenderWindow(w, pMonitor))
-            continue;
+    m_sSceneSnapshot.update(pMonitor, time);
 
-        if (w->m_alpha->value() == 0.f)
+    // loop over the tiled windows that are fading out
+    for (auto const& node : m_sSceneSnapshot.windows()) {
+        if (node.alpha == 0.f || !node.window)
             continue;
 
-        if (w->isFullscreen() || w->m_isFloating)
+        if (node.fullscreen || node.floating)
             continue;
 
-        if (pWorkspace->m_isSpecialWorkspace != w->onSpecialWorkspace())
+        if (pWorkspace->m_isSpecialWorkspace != node.special)
             continue;
 
-        renderWindow(w, pMonitor, time, true, RENDER_PASS_ALL);
+        renderWindow(node.window.lock(), pMonitor, time, true, RENDER_PASS_ALL);
     }
 
     // and floating ones too
-    for (auto const& w : g_pCompositor->m_windows) {
-        if (!shouldRenderWindow(w, pMonitor))
+    for (auto const& node : m_sSceneSnapshot.windows()) {
+        if (node.alpha == 0.f || !node.window)
             continue;
 
-        if (w->m_alpha->value() == 0.f)
+        if (node.fullscreen || !node.floating)
             continue;
 
-        if (w->isFullscreen() || !w->m_isFloating)
-            continue;
-
-        if (w->m_monitor == pWorkspace->m_monitor && pWorkspace->m_isSpecialWorkspace != w->onSpecialWorkspace())
+        if (node.monitor == pWorkspace->monitorID() && pWorkspace->m_isSpecialWorkspace != node.special)
             continue;
 
-        if (pWorkspace->m_isSpecialWorkspace && w->m_monitor != pWorkspace->m_monitor)
+        if (pWorkspace->m_isSpecialWorkspace && node.monitor != pWorkspace->monitorID())
             continue; // special on another are rendered as a part of the base pass
 
-        renderWindow(w, pMonitor, time, true, RENDER_PASS_ALL);
+        renderWindow(node.window.lock(), pMonitor, time, true, RENDER_PASS_ALL);
     }
 
     // TODO: this pass sucks
     for (auto const& w : g_pCompositor->m_windows) {
-        const auto PWORKSPACE = w->m_workspace;
+        const auto PWORKSPACE = w->workspace();
 
-        if (w->m_workspace != pWorkspace || !w->isFullscreen()) {
+        if (w->workspace() != pWorkspace || !w->isFullscreen()) {
             if (!(PWORKSPACE && (PWORKSPACE->m_renderOffset->isBeingAnimated() || PWORKSPACE->m_alpha->isBeingAnimated() || PWORKSPACE->m_forceRendering)))
                 continue;
 
@@ -324,7 +325,7 @@ void CHyprRenderer::renderWorkspaceWindowsFullscreen(PHLMONITOR pMonitor, PHLWOR
         if (shouldRenderWindow(w, pMonitor))
             renderWindow(w, pMonitor, time, pWorkspace->m_fullscreenMode != FSMODE_FULLSCREEN, RENDER_PASS_ALL);
 
-        if (w->m_workspace != pWorkspace)
+        if (w->workspace() != pWorkspace)
             continue;
 
         pWorkspaceWindow = w;
@@ -352,51 +353,128 @@ void CHyprRenderer::renderWorkspaceWindowsFullscreen(PHLMONITOR pMonitor, PHLWOR
     }
 }
 
+static bool passesSpecialCheck(const SSceneWindow& node, PHLWORKSPACE pWorkspace) {
+    // some things may force us to ignore the special/not special disparity
+    return node.ignoreSpecialCheck || pWorkspace->m_isSpecialWorkspace == node.special;
+}
+
+// tiled windows fully covered by opaque windows drawn above them, these can be skipped before building any pass elements
+static std::vector<const SSceneWindow*> findOccludedWindows(PHLWORKSPACE pWorkspace, const std::vector<const SSceneWindow*>& windows) {
+    static auto                      POCCLUSION = CConfigValue<Hyprlang::INT>("render:occlusion_culling");
+
+    std::vector<const SSceneWindow*> occluded;
+
+    if (!*POCCLUSION)
+        return occluded;
+
+    CRegion    covered;
+    const auto LASTWINDOW = g_pCompositor->m_lastWindow.lock();
+
+    const auto addOccluder = [&covered](const SSceneWindow* node) {
+        if (!node->opaqueBox.empty())
+            covered.add(node->opaqueBox);
+    };
+
+    // front to back: floating windows are drawn above everything tiled, then the focused tiled window
+    for (auto const& node : windows) {
+        if (!node->floating || node->pinned || !passesSpecialCheck(*node, pWorkspace))
+            continue;
+
+        if (pWorkspace->m_isSpecialWorkspace && node->monitor != pWorkspace->monitorID())
+            continue;
+
+        addOccluder(node);
+    }
+
+    const auto LASTNODE = std::ranges::find_if(windows, [&LASTWINDOW](const SSceneWindow* node) { return LASTWINDOW && node->window.lock() == LASTWINDOW; });
+
+    if (LASTNODE != windows.end() && !(*LASTNODE)->floating && passesSpecialCheck(**LASTNODE, pWorkspace))
+        addOccluder(*LASTNODE);
+
+    for (auto const& node : windows | std::views::reverse) {
+        if (covered.empty())
+            break;
+
+        if (node->floating || node->fadingOut || (LASTNODE != windows.end() && node == *LASTNODE) || !passesSpecialCheck(*node, pWorkspace))
+            continue;
+
+        // dim_around paints the whole monitor and transformers may draw anywhere, never skip those
+        if (node->cullable && CRegion{node->fullBox}.subtract(covered).empty()) {
+            occluded.emplace_back(node);
+            continue;
+        }
+
+        addOccluder(node);
+    }
+
+    return occluded;
+}
+
+void CHyprRenderer::skipOccludedWindow(PHLWINDOW pWindow, PHLMONITOR pMonitor, const Time::steady_tp& time) {
+    // the client still gets its frame callbacks, just as if its elements were discarded by the pass
+    size_t surfaces = 0;
+    pWindow->m_wlSurface->resource()->breadthfirst(
+        [&time, &pMonitor, &surfaces](SP<CWLSurfaceResource> s, const Vector2D& offset, void* data) {
+            s->presentFeedback(time, pMonitor, true);
+            surfaces++;
+        },
+        nullptr);
+
+    m_sOcclusionStats.windows++;
+    m_sOcclusionStats.elements += surfaces + pWindow->m_windowDecorations.size();
+}
+
 void CHyprRenderer::renderWorkspaceWindows(PHLMONITOR pMonitor, PHLWORKSPACE pWorkspace, const Time::steady_tp& time) {
     PHLWINDOW lastWindow;
 
     EMIT_HOOK_EVENT("render", RENDER_PRE_WINDOWS);
 
-    std::vector<PHLWINDOWREF> windows, tiledFadingOut;
-    windows.reserve(g_pCompositor->m_windows.size());
+    m_sSceneSnapshot.update(pMonitor, time);
 
-    for (auto const& w : g_pCompositor->m_windows) {
-        if (w->isHidden() || (!w->m_isMapped && !w->m_fadingOut))
-            continue;
+    std::vector<const SSceneWindow*> windows, tiledFadingOut;
+    windows.reserve(m_sSceneSnapshot.windows().size());
 
-        if (!shouldRenderWindow(w, pMonitor))
+    for (auto const& node : m_sSceneSnapshot.windows()) {
+        if (node.hidden || (!node.mapped && !node.fadingOut) || !node.window)
             continue;
 
-        windows.emplace_back(w);
+        windows.emplace_back(&node);
     }
 
+    const auto OCCLUDED = findOccludedWindows(pWorkspace, windows);
+
     // Non-floating main
-    for (auto& w : windows) {
-        if (w->m_isFloating)
+    for (auto& node : windows) {
+        if (node->floating)
             continue; // floating are in the second pass
 
-        // some things may force us to ignore the special/not special disparity
-        const bool IGNORE_SPECIAL_CHECK = w->m_monitorMovedFrom != -1 && (w->m_workspace && !w->m_workspace->isVisible());
-
-        if (!IGNORE_SPECIAL_CHECK && pWorkspace->m_isSpecialWorkspace != w->onSpecialWorkspace())
+        if (!passesSpecialCheck(*node, pWorkspace))
             continue;
 
+        const auto w = node->window.lock();
+
         // render active window after all others of this pass
         if (w == g_pCompositor->m_lastWindow) {
-            lastWindow = w.lock();
+            lastWindow = w;
             continue;
         }
 
         // render tiled fading out after others
-        if (w->m_fadingOut) {
-            tiledFadingOut.emplace_back(w);
-            w.reset();
+        if (node->fadingOut) {
+            tiledFadingOut.emplace_back(node);
+            node = nullptr;
+            continue;
+        }
+
+        if (std::ranges::find(OCCLUDED, node) != OCCLUDED.end()) {
+            skipOccludedWindow(w, pMonitor, time);
+            node = nullptr;
             continue;
         }
 
         // render the bad boy
-        renderWindow(w.lock(), pMonitor, time, true, RENDER_PASS_MAIN);
-        w.reset();
+        renderWindow(w, pMonitor, time, true, RENDER_PASS_MAIN);
+        node = nullptr;
     }
 
     if (lastWindow)
@@ -405,48 +483,42 @@ void CHyprRenderer::renderWorkspaceWindows(PHLMONITOR pMonitor, PHLWORKSPACE pWo
     lastWindow.reset();
 
     // render tiled windows that are fading out after other tiled to not hide them behind
-    for (auto& w : tiledFadingOut) {
-        renderWindow(w.lock(), pMonitor, time, true, RENDER_PASS_MAIN);
+    for (auto const& node : tiledFadingOut) {
+        renderWindow(node->window.lock(), pMonitor, time, true, RENDER_PASS_MAIN);
     }
 
     // Non-floating popup
-    for (auto& w : windows) {
-        if (!w)
+    for (auto& node : windows) {
+        if (!node)
             continue;
 
-        if (w->m_isFloating)
+        if (node->floating)
             continue; // floating are in the second pass
 
-        // some things may force us to ignore the special/not special disparity
-        const bool IGNORE_SPECIAL_CHECK = w->m_monitorMovedFrom != -1 && (w->m_workspace && !w->m_workspace->isVisible());
-
-        if (!IGNORE_SPECIAL_CHECK && pWorkspace->m_isSpecialWorkspace != w->onSpecialWorkspace())
+        if (!passesSpecialCheck(*node, pWorkspace))
             continue;
 
         // render the bad boy
-        renderWindow(w.lock(), pMonitor, time, true, RENDER_PASS_POPUP);
-        w.reset();
+        renderWindow(node->window.lock(), pMonitor, time, true, RENDER_PASS_POPUP);
+        node = nullptr;
     }
 
     // floating on top
-    for (auto& w : windows) {
-        if (!w)
+    for (auto& node : windows) {
+        if (!node)
             continue;
 
-        if (!w->m_isFloating || w->m_pinned)
+        if (!node->floating || node->pinned)
             continue;
 
-        // some things may force us to ignore the special/not special disparity
-        const bool IGNORE_SPECIAL_CHECK = w->m_monitorMovedFrom != -1 && (w->m_workspace && !w->m_workspace->isVisible());
-
-        if (!IGNORE_SPECIAL_CHECK && pWorkspace->m_isSpecialWorkspace != w->onSpecialWorkspace())
+        if (!passesSpecialCheck(*node, pWorkspace))
             continue;
 
-        if (pWorkspace->m_isSpecialWorkspace && w->m_monitor != pWorkspace->m_monitor)
+        if (pWorkspace->m_isSpecialWorkspace && node->monitor != pWorkspace->monitorID())
             continue; // special on another are rendered as a part of the base pass
 
         // render the bad boy
-        renderWindow(w.lock(), pMonitor, time, true, RENDER_PASS_ALL);
+        renderWindow(node->window.lock(), pMonitor, time, true, RENDER_PASS_ALL);
     }
 }
 
@@ -465,7 +537,7 @@ void CHyprRenderer::renderWindow(PHLWINDOW pWindow, PHLMONITOR pMonitor, const T
 
     TRACY_GPU_ZONE("RenderWindow");
 
-    const auto                       PWORKSPACE = pWindow->m_workspace;
+    const auto                       PWORKSPACE = pWindow->workspace();
     const auto                       REALPOS    = pWindow->m_realPosition->value() + (pWindow->m_pinned ? Vector2D{} : PWORKSPACE->m_renderOffset->value());
     static auto                      PDIMAROUND = CConfigValue<Hyprlang::FLOAT>("decoration:dim_around");
     static auto                      PBLUR      = CConfigValue<Hyprlang::INT>("decoration:blur:enabled");
@@ -525,7 +597,7 @@ void CHyprRenderer::renderWindow(PHLWINDOW pWindow, PHLMONITOR pMonitor, const T
         CRectPassElement::SRectData data;
         data.color = CHyprColor(0, 0, 0, *PDIMAROUND * renderdata.alpha * renderdata.fadeAlpha);
         data.box   = monbox;
-        m_sRenderPass.add(makeShared<CRectPassElement>(data));
+        m_sRenderPass.emplace<CRectPassElement>(data);
     }
 
     renderdata.pos.x += pWindow->m_floatingOffset.x;
@@ -581,7 +653,7 @@ void CHyprRenderer::renderWindow(PHLWINDOW pWindow, PHLMONITOR pMonitor, const T
             data.blur  = true;
             data.blurA = renderdata.fadeAlpha;
             data.xray  = g_pHyprOpenGL->shouldUseNewBlurOptimizations(nullptr, pWindow);
-            m_sRenderPass.add(makeShared<CRectPassElement>(data));
+            m_sRenderPass.emplace<CRectPassElement>(data);
             renderdata.blur = false;
         }
 
@@ -592,7 +664,7 @@ void CHyprRenderer::renderWindow(PHLWINDOW pWindow, PHLMONITOR pMonitor, const T
                 renderdata.texture     = s->m_current.texture;
                 renderdata.surface     = s;
                 renderdata.mainSurface = s == pWindow->m_wlSurface->resource();
-                m_sRenderPass.add(makeShared<CSurfacePassElement>(renderdata));
+                m_sRenderPass.emplace<CSurfacePassElement>(renderdata);
                 renderdata.surfaceCounter++;
             },
             nullptr);
@@ -660,7 +732,7 @@ void CHyprRenderer::renderWindow(PHLWINDOW pWindow, PHLMONITOR pMonitor, const T
                             renderdata.texture     = s->m_current.texture;
                             renderdata.surface     = s;
                             renderdata.mainSurface = false;
-                            m_sRenderPass.add(makeShared<CSurfacePassElement>(renderdata));
+                            m_sRenderPass.emplace<CSurfacePassElement>(renderdata);
                             renderdata.surfaceCounter++;
                         },
                         data);
@@ -702,7 +774,7 @@ void CHyprRenderer::renderLayer(PHLLS pLayer, PHLMONITOR pMonitor, const Time::s
         CRectPassElement::SRectData data;
         data.box   = {0, 0, g_pHyprOpenGL->m_RenderData.pMonitor->m_transformedSize.x, g_pHyprOpenGL->m_RenderData.pMonitor->m_transformedSize.y};
         data.color = CHyprColor(0, 0, 0, *PDIMAROUND * pLayer->m_alpha->value());
-        m_sRenderPass.add(makeShared<CRectPassElement>(data));
+        m_sRenderPass.emplace<CRectPassElement>(data);
     }
 
     if (pLayer->m_fadingOut) {
@@ -742,7 +814,7 @@ void CHyprRenderer::renderLayer(PHLLS pLayer, PHLMONITOR pMonitor, const Time::s
                 renderdata.texture     = s->m_current.texture;
                 renderdata.surface     = s;
                 renderdata.mainSurface = s == pLayer->m_surface->resource();
-                m_sRenderPass.add(makeShared<CSurfacePassElement>(renderdata));
+                m_sRenderPass.emplace<CSurfacePassElement>(renderdata);
                 renderdata.surfaceCounter++;
             },
             &renderdata);
@@ -763,7 +835,7 @@ void CHyprRenderer::renderLayer(PHLLS pLayer, PHLMONITOR pMonitor, const Time::s
                 renderdata.texture     = popup->m_wlSurface->resource()->m_current.texture;
                 renderdata.surface     = popup->m_wlSurface->resource();
                 renderdata.mainSurface = false;
-                m_sRenderPass.add(makeShared<CSurfacePassElement>(renderdata));
+                m_sRenderPass.emplace<CSurfacePassElement>(renderdata);
                 renderdata.surfaceCounter++;
             },
             &renderdata);
@@ -798,7 +870,7 @@ void CHyprRenderer::renderIMEPopup(CInputPopup* pPopup, PHLMONITOR pMonitor, con
             renderdata.texture     = s->m_current.texture;
             renderdata.surface     = s;
             renderdata.mainSurface = s == SURF;
-            m_sRenderPass.add(makeShared<CSurfacePassElement>(renderdata));
+            m_sRenderPass.emplace<CSurfacePassElement>(renderdata);
             renderdata.surfaceCounter++;
         },
         &renderdata);
@@ -819,7 +891,7 @@ void CHyprRenderer::renderSessionLockSurface(WP<SSessionLockSurface> pSurface, P
             renderdata.texture     = s->m_current.texture;
             renderdata.surface     = s;
             renderdata.mainSurface = s == pSurface->surface->surface();
-            m_sRenderPass.add(makeShared<CSurfacePassElement>(renderdata));
+            m_sRenderPass.emplace<CSurfacePassElement>(renderdata);
             renderdata.surfaceCounter++;
         },
         &renderdata);
@@ -853,12 +925,12 @@ void CHyprRenderer::renderAllClientsForWorkspace(PHLMONITOR pMonitor, PHLWORKSPA
         RENDERMODIFDATA.modifs.emplace_back(std::make_pair<>(SRenderModifData::eRenderModifType::RMOD_TYPE_SCALE, scale));
 
     if (!RENDERMODIFDATA.modifs.empty()) {
-        g_pHyprRenderer->m_sRenderPass.add(makeShared<CRendererHintsPassElement>(CRendererHintsPassElement::SData{RENDERMODIFDATA}));
+        g_pHyprRenderer->m_sRenderPass.emplace<CRendererHintsPassElement>(CRendererHintsPassElement::SData{RENDERMODIFDATA});
     }
 
     CScopeGuard x([&RENDERMODIFDATA] {
         if (!RENDERMODIFDATA.modifs.empty()) {
-            g_pHyprRenderer->m_sRenderPass.add(makeShared<CRendererHintsPassElement>(CRendererHintsPassElement::SData{SRenderModifData{}}));
+            g_pHyprRenderer->m_sRenderPass.emplace<CRendererHintsPassElement>(CRendererHintsPassElement::SData{SRenderModifData{}});
         }
     });
 
@@ -866,7 +938,7 @@ void CHyprRenderer::renderAllClientsForWorkspace(PHLMONITOR pMonitor, PHLWORKSPA
         // allow rendering without a workspace. In this case, just render layers.
 
         if (*PRENDERTEX /* inverted cfg flag */)
-            m_sRenderPass.add(makeShared<CClearPassElement>(CClearPassElement::SClearData{CHyprColor(*PBACKGROUNDCOLOR)}));
+            m_sRenderPass.emplace<CClearPassElement>(CClearPassElement::SClearData{CHyprColor(*PBACKGROUNDCOLOR)});
         else
             g_pHyprOpenGL->clearWithTex(); // will apply the hypr "wallpaper"
 
@@ -888,7 +960,7 @@ void CHyprRenderer::renderAllClientsForWorkspace(PHLMONITOR pMonitor, PHLWORKSPA
 
     if (!*PXPMODE) {
         if (*PRENDERTEX /* inverted cfg flag */)
-            m_sRenderPass.add(makeShared<CClearPassElement>(CClearPassElement::SClearData{CHyprColor(*PBACKGROUNDCOLOR)}));
+            m_sRenderPass.emplace<CClearPassElement>(CClearPassElement::SClearData{CHyprColor(*PBACKGROUNDCOLOR)});
         else
             g_pHyprOpenGL->clearWithTex(); // will apply the hypr "wallpaper"
 
@@ -919,7 +991,7 @@ void CHyprRenderer::renderAllClientsForWorkspace(PHLMONITOR pMonitor, PHLWORKSPA
                 data.box   = {translate.x, translate.y, pMonitor->m_transformedSize.x * scale, pMonitor->m_transformedSize.y * scale};
                 data.color = CHyprColor(0, 0, 0, *PDIMSPECIAL * (ANIMOUT ? (1.0 - SPECIALANIMPROGRS) : SPECIALANIMPROGRS));
 
-                g_pHyprRenderer->m_sRenderPass.add(makeShared<CRectPassElement>(data));
+                g_pHyprRenderer->m_sRenderPass.emplace<CRectPassElement>(data);
             }
 
             if (*PBLURSPECIAL && *PBLUR) {
@@ -929,7 +1001,7 @@ void CHyprRenderer::renderAllClientsForWorkspace(PHLMONITOR pMonitor, PHLWORKSPA
                 data.blur  = true;
                 data.blurA = (ANIMOUT ? (1.0 - SPECIALANIMPROGRS) : SPECIALANIMPROGRS);
 
-                g_pHyprRenderer->m_sRenderPass.add(makeShared<CRectPassElement>(data));
+                g_pHyprRenderer->m_sRenderPass.emplace<CRectPassElement>(data);
             }
 
             break;
@@ -1146,6 +1218,45 @@ void CHyprRenderer::calculateUVForSurface(PHLWINDOW pWindow, SP<CWLSurfaceResour
     }
 }
 
+void CHyprRenderer::queueMonitorRender(PHLMONITOR pMonitor) {
+    if (std::ranges::any_of(m_vQueuedRenders, [&](const auto& other) { return other.lock() == pMonitor; }))
+        return;
+
+    m_vQueuedRenders.emplace_back(pMonitor);
+
+    // page flips of several outputs usually land in one dispatch, collect all of them before picking an order
+    if (m_vQueuedRenders.size() == 1)
+        g_pEventLoopManager->doLater([this]() { renderQueuedMonitors(); });
+}
+
+void CHyprRenderer::renderQueuedMonitors() {
+    // the session may have gone away between the frame events and this idle
+    if (!CMonitor::sessionCanRender()) {
+        m_vQueuedRenders.clear();
+        return;
+    }
+
+    std::vector<std::pair<Time::steady_tp, PHLMONITOR>> order;
+    order.reserve(m_vQueuedRenders.size());
+
+    for (auto const& ref : m_vQueuedRenders) {
+        const auto PMONITOR = ref.lock();
+        if (!PMONITOR || !PMONITOR->m_enabled)
+            continue;
+
+        order.emplace_back(PMONITOR->m_frameScheduler ? PMONITOR->m_frameScheduler->renderDeadline() : Time::steadyNow(), PMONITOR);
+    }
+
+    m_vQueuedRenders.clear();
+
+    // everything shares one GL context on this thread, so the best we can do is to not let an expensive monitor push a faster one past its vblank
+    std::ranges::stable_sort(order, [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    for (auto const& [deadline, mon] : order) {
+        renderMonitor(mon);
+    }
+}
+
 void CHyprRenderer::renderMonitor(PHLMONITOR pMonitor) {
     static std::chrono::high_resolution_clock::time_point renderStart        = std::chrono::high_resolution_clock::now();
     static std::chrono::high_resolution_clock::time_point renderStartOverlay = std::chrono::high_resolution_clock::now();
@@ -1190,6 +1301,8 @@ void CHyprRenderer::renderMonitor(PHLMONITOR pMonitor) {
 
     renderStart = std::chrono::high_resolution_clock::now();
 
+    TRACE_SCOPE("renderMonitor", TRACE_CATEGORY_RENDER, "monitor", pMonitor->m_id);
+
     if (*PDEBUGOVERLAY == 1)
         g_pDebugOverlay->frameData(pMonitor);
 
@@ -1262,6 +1375,9 @@ void CHyprRenderer::renderMonitor(PHLMONITOR pMonitor) {
 
     const auto NOW = Time::steadyNow();
 
+    m_sOcclusionStats = {};
+    m_sSceneSnapshot.invalidate(); // rebuilt on first use this frame
+
     // check the damage
     bool hasChanged = pMonitor->m_output->needsFrame || pMonitor->m_damage.hasChanged();
 
@@ -1361,7 +1477,7 @@ void CHyprRenderer::renderMonitor(PHLMONITOR pMonitor) {
                     CRectPassElement::SRectData data;
                     data.box   = {0, 0, pMonitor->m_transformedSize.x, pMonitor->m_transformedSize.y};
                     data.color = CHyprColor(1.0, 0.0, 1.0, 100.0 / 255.0);
-                    m_sRenderPass.add(makeShared<CRectPassElement>(data));
+                    m_sRenderPass.emplace<CRectPassElement>(data);
                     damageBlinkCleanup = 1;
                 } else if (*PDAMAGEBLINK) {
                     damageBlinkCleanup++;
@@ -1424,6 +1540,11 @@ void CHyprRenderer::renderMonitor(PHLMONITOR pMonitor) {
 
     const float durationUs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - renderStart).count() / 1000.f;
     g_pDebugOverlay->renderData(pMonitor, durationUs);
+    g_pFrameMetrics->onRender(pMonitor, durationUs);
+    if (pMonitor->m_frameScheduler)
+        pMonitor->m_frameScheduler->onRendered(durationUs);
+    g_pFrameMetrics->onOcclusion(pMonitor, m_sOcclusionStats.windows, m_sOcclusionStats.elements);
+    g_pFrameMetrics->onPass(pMonitor, m_sRenderPass.elementCount(), m_sRenderPass.allocations());
 
     if (*PDEBUGOVERLAY == 1) {
         if (pMonitor == g_pCompositor->m_monitors.front()) {
@@ -1478,6 +1599,8 @@ static hdr_output_metadata       createHDRMetadata(SImageDescription settings, A
 }
 
 bool CHyprRenderer::commitPendingAndDoExplicitSync(PHLMONITOR pMonitor) {
+    TRACE_SCOPE("commit", TRACE_CATEGORY_OUTPUT, "monitor", pMonitor->m_id);
+
     static auto PCT   = CConfigValue<Hyprlang::INT>("render:send_content_type");
     static auto PPASS = CConfigValue<Hyprlang::INT>("render:cm_fs_passthrough");
     const bool  PHDR  = pMonitor->m_imageDescription.transferFunction == CM_TRANSFER_FUNCTION_ST2084_PQ;
@@ -1572,6 +1695,17 @@ bool CHyprRenderer::commitPendingAndDoExplicitSync(PHLMONITOR pMonitor) {
         }
     }
 
+    if (ok) {
+        g_pFrameMetrics->onCommit(pMonitor);
+
+        // one-shot, this is the hot path
+        static bool firstFrameMarked = false;
+        if (!firstFrameMarked && g_pStartupTasks) {
+            g_pStartupTasks->mark("first frame");
+            firstFrameMarked = true;
+        }
+    }
+
     return ok;
 }
 
@@ -1869,7 +2003,7 @@ void CHyprRenderer::damageWindow(PHLWINDOW pWindow, bool forceFull) {
         return;
 
     CBox       windowBox        = pWindow->getFullWindowBoundingBox();
-    const auto PWINDOWWORKSPACE = pWindow->m_workspace;
+    const auto PWINDOWWORKSPACE = pWindow->workspace();
     if (PWINDOWWORKSPACE && PWINDOWWORKSPACE->m_renderOffset->isBeingAnimated() && !pWindow->m_pinned)
         windowBox.translate(PWINDOWWORKSPACE->m_renderOffset->value());
     windowBox.translate(pWindow->m_floatingOffset);
@@ -2218,10 +2352,6 @@ bool CHyprRenderer::beginRender(PHLMONITOR pMonitor, CRegion& damage, eRenderMod
         return true;
     }
 
-    /* This is a constant expression, as we always use double-buffering in our swapchain
-        TODO: Rewrite the CDamageRing to take advantage of that maybe? It's made to support longer swapchains atm because we used to do wlroots */
-    static constexpr const int HL_BUFFER_AGE = 2;
-
     if (!buffer) {
         m_pCurrentBuffer = pMonitor->m_output->swapchain->next(nullptr);
         if (!m_pCurrentBuffer) {
@@ -2244,8 +2374,14 @@ bool CHyprRenderer::beginRender(PHLMONITOR pMonitor, CRegion& damage, eRenderMod
     }
 
     if (mode == RENDER_MODE_NORMAL) {
-        damage = pMonitor->m_damage.getBufferDamage(HL_BUFFER_AGE);
+        // our swapchain just rotates its buffers, so a buffer's age is the swapchain length
+        const int BUFFER_AGE = pMonitor->m_output->swapchain->currentOptions().length;
+
+        pMonitor->m_damage.setBufferCount(BUFFER_AGE);
+        damage = pMonitor->m_damage.getBufferDamage(BUFFER_AGE);
         pMonitor->m_damage.rotate();
+
+        g_pFrameMetrics->onRepaint(pMonitor, damage);
     }
 
     m_pCurrentRenderbuffer->bind();
@@ -2261,6 +2397,8 @@ void CHyprRenderer::endRender(const std::function<void()>& renderingDoneCallback
     const auto  PMONITOR           = g_pHyprOpenGL->m_RenderData.pMonitor;
     static auto PNVIDIAANTIFLICKER = CConfigValue<Hyprlang::INT>("opengl:nvidia_anti_flicker");
 
+    TRACE_SCOPE("endRender", TRACE_CATEGORY_RENDER, "monitor", PMONITOR ? PMONITOR->m_id : MONITOR_INVALID);
+
     g_pHyprOpenGL->m_RenderData.damage = m_sRenderPass.render(g_pHyprOpenGL->m_RenderData.damage);
 
     auto cleanup = CScopeGuard([this]() {
@@ -2539,7 +2677,7 @@ void CHyprRenderer::renderSnapshot(PHLWINDOW pWindow) {
         data.box   = {0, 0, g_pHyprOpenGL->m_RenderData.pMonitor->m_pixelSize.x, g_pHyprOpenGL->m_RenderData.pMonitor->m_pixelSize.y};
         data.color = CHyprColor(0, 0, 0, *PDIMAROUND * pWindow->m_alpha->value());
 
-        m_sRenderPass.add(makeShared<CRectPassElement>(data));
+        m_sRenderPass.emplace<CRectPassElement>(data);
         damageMonitor(PMONITOR);
     }
 
@@ -2550,7 +2688,7 @@ void CHyprRenderer::renderSnapshot(PHLWINDOW pWindow) {
     data.a            = pWindow->m_alpha->value();
     data.damage       = fakeDamage;
 
-    m_sRenderPass.add(makeShared<CTexPassElement>(data));
+    m_sRenderPass.emplace<CTexPassElement>(data);
 }
 
 void CHyprRenderer::renderSnapshot(PHLLS pLayer) {
@@ -2586,5 +2724,5 @@ void CHyprRenderer::renderSnapshot(PHLLS pLayer) {
     data.a            = pLayer->m_alpha->value();
     data.damage       = fakeDamage;
 
-    m_sRenderPass.add(makeShared<CTexPassElement>(data));
+    m_sRenderPass.emplace<CTexPassElement>(data);
 }
@@ -6,6 +6,7 @@
 #include "../desktop/LayerSurface.hpp"
 #include "OpenGL.hpp"
 #include "Renderbuffer.hpp"
+#include "SceneSnapshot.hpp"
 #include "../helpers/time/Timer.hpp"
 #include "../helpers/math/Math.hpp"
 #include "../helpers/time/Time.hpp"
@@ -51,6 +52,7 @@ class CHyprRenderer {
     ~CHyprRenderer();
 
     void renderMonitor(PHLMONITOR pMonitor);
+    void queueMonitorRender(PHLMONITOR pMonitor); // renders at the end of the current dispatch, earliest deadline first
     void arrangeLayersForMonitor(const MONITORID&);
     void damageSurface(SP<CWLSurfaceResource>, double, double, double scale = 1.0);
     void damageWindow(PHLWINDOW, bool forceFull = false);
@@ -113,12 +115,20 @@ class CHyprRenderer {
         std::string                   name;
     } m_sLastCursorData;
 
-    CRenderPass m_sRenderPass = {};
+    CRenderPass    m_sRenderPass = {};
+    CSceneSnapshot m_sSceneSnapshot;
+
+    // windows skipped by the occlusion pre-pass this frame, and the pass elements they would have made
+    struct {
+        size_t windows  = 0;
+        size_t elements = 0;
+    } m_sOcclusionStats;
 
   private:
     void arrangeLayerArray(PHLMONITOR, const std::vector<PHLLSREF>&, bool, CBox*);
     void renderWorkspaceWindowsFullscreen(PHLMONITOR, PHLWORKSPACE, const Time::steady_tp&); // renders workspace windows (fullscreen) (tiled, floating, pinned, but no special)
     void renderWorkspaceWindows(PHLMONITOR, PHLWORKSPACE, const Time::steady_tp&);           // renders workspace windows (no fullscreen) (tiled, floating, pinned, but no special)
+    void skipOccludedWindow(PHLWINDOW, PHLMONITOR, const Time::steady_tp&);                  // sends frame events and counts the window as culled
     void renderWindow(PHLWINDOW, PHLMONITOR, const Time::steady_tp&, bool, eRenderPassMode, bool ignorePosition = false, bool standalone = false);
     void renderLayer(PHLLS, PHLMONITOR, const Time::steady_tp&, bool popups = false, bool lockscreen = false);
     void renderSessionLockSurface(WP<SSessionLockSurface>, PHLMONITOR, const Time::steady_tp&);
@@ -149,6 +159,9 @@ class CHyprRenderer {
     std::vector<PHLWINDOWREF>      m_vRenderUnfocused;
     SP<CEventLoopTimer>            m_tRenderUnfocusedTimer;
 
+    void                           renderQueuedMonitors();
+    std::vector<PHLMONITORREF>     m_vQueuedRenders;
+
     friend class CHyprOpenGLImpl;
     friend class CToplevelExportFrame;
     friend class CInputManager;
@@ -0,0 +1,95 @@
+#include "SceneSnapshot.hpp"
+#include "Renderer.hpp"
+#include "../Compositor.hpp"
+#include "../config/ConfigValue.hpp"
+#include "../desktop/Window.hpp"
+#include "../desktop/Workspace.hpp"
+#include "../protocols/core/Compositor.hpp"
+
+static Vector2D windowRenderOffset(PHLWINDOW pWindow) {
+    return (pWindow->m_pinned || !pWindow->workspace() ? Vector2D{} : pWindow->workspace()->m_renderOffset->value()) + pWindow->m_floatingOffset;
+}
+
+// CWindow::opaque() is a blur hint and may be wrong, a window that occludes something has to be opaque over every pixel of its surface
+static bool surfaceFullyOpaque(PHLWINDOW pWindow) {
+    if (pWindow->m_alpha->value() != 1.F || pWindow->m_activeInactiveAlpha->value() != 1.F || pWindow->workspace()->m_alpha->value() != 1.F)
+        return false;
+
+    const auto SURFACE = pWindow->m_wlSurface->resource();
+    if (!SURFACE || !SURFACE->m_current.texture || pWindow->m_wlSurface->small())
+        return false;
+
+    // a buffer without alpha has no holes
+    if (SURFACE->m_current.texture->m_bOpaque)
+        return true;
+
+    // otherwise the opaque region, in surface coordinates, has to contain the whole surface box
+    return CRegion{CBox{{}, SURFACE->m_current.size}}.subtract(SURFACE->m_current.opaque).empty();
+}
+
+// the part of a window that is guaranteed to be painted fully opaque. Conservative, empty if unsure.
+static CBox windowOpaqueBox(PHLWINDOW pWindow, const Vector2D& offset) {
+    if (pWindow->m_fadingOut || !pWindow->m_isMapped || pWindow->m_monitorMovedFrom != -1 || !pWindow->m_transformers.empty() || !pWindow->workspace())
+        return {};
+
+    if (pWindow->m_realPosition->isBeingAnimated() || pWindow->m_realSize->isBeingAnimated() || pWindow->m_movingFromWorkspaceAlpha->value() != 1.F)
+        return {};
+
+    if (!surfaceFullyOpaque(pWindow))
+        return {};
+
+    // a surface lagging behind a resize doesn't cover the whole box
+    const auto SURFACESIZE = pWindow->m_wlSurface->resource()->m_current.size;
+    if (std::abs(SURFACESIZE.x - pWindow->m_realSize->value().x) >= 1 || std::abs(SURFACESIZE.y - pWindow->m_realSize->value().y) >= 1)
+        return {};
+
+    return CBox{pWindow->m_realPosition->value(), pWindow->m_realSize->value()}.translate(offset).expand(-pWindow->rounding());
+}
+
+void CSceneSnapshot::update(PHLMONITOR pMonitor, const Time::steady_tp& time) {
+    if (m_valid && m_monitor == pMonitor->m_id && m_time == time)
+        return;
+
+    static auto POCCLUSION = CConfigValue<Hyprlang::INT>("render:occlusion_culling");
+
+    m_windows.clear();
+    m_monitor = pMonitor->m_id;
+    m_time    = time;
+    m_valid   = true;
+
+    for (auto const& w : g_pCompositor->m_windows) {
+        if (!g_pHyprRenderer->shouldRenderWindow(w, pMonitor))
+            continue;
+
+        const auto OFFSET = windowRenderOffset(w);
+
+        auto&      node         = m_windows.emplace_back();
+        node.window             = w;
+        node.alpha              = w->m_alpha->value();
+        node.floating           = w->m_isFloating;
+        node.fullscreen         = w->isFullscreen();
+        node.pinned             = w->m_pinned;
+        node.special            = w->onSpecialWorkspace();
+        node.fadingOut          = w->m_fadingOut;
+        node.hidden             = w->isHidden();
+        node.mapped             = w->m_isMapped;
+        node.ignoreSpecialCheck = w->m_monitorMovedFrom != -1 && (w->workspace() && !w->workspace()->isVisible());
+        node.monitor            = w->monitorID();
+
+        // only the occlusion pre-pass looks at these
+        if (!*POCCLUSION)
+            continue;
+
+        node.fullBox   = w->getFullWindowBoundingBox().translate(OFFSET);
+        node.opaqueBox = windowOpaqueBox(w, OFFSET);
+        node.cullable  = w->m_transformers.empty() && !w->m_windowData.dimAround.valueOrDefault();
+    }
+}
+
+void CSceneSnapshot::invalidate() {
+    m_valid = false;
+}
+
+const std::vector<SSceneWindow>& CSceneSnapshot::windows() const {
+    return m_windows;
+}
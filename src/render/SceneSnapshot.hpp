@@ -0,0 +1,50 @@
+#pragma once
+
+#include <vector>
+#include "../defines.hpp"
+#include "../helpers/math/Math.hpp"
+#include "../helpers/time/Time.hpp"
+
+/*
+    A window a monitor is about to render, with the state the window passes and
+    the occlusion pre-pass branch on resolved once: animated geometry, offsets,
+    alpha and the boxes used for culling.
+*/
+struct SSceneWindow {
+    PHLWINDOWREF window;
+    CBox         fullBox;   // with decorations, in render coordinates
+    CBox         opaqueBox; // guaranteed to be painted fully opaque, in render coordinates. Empty if unsure
+    float        alpha              = 1.F;
+    bool         floating           = false;
+    bool         fullscreen         = false;
+    bool         pinned             = false;
+    bool         special            = false;
+    bool         fadingOut          = false;
+    bool         hidden             = false;
+    bool         mapped             = false;
+    bool         ignoreSpecialCheck = false; // moving between monitors onto a workspace that isn't visible
+    bool         cullable           = false; // no transformers and no dim_around, its box is all it paints
+    MONITORID    monitor            = MONITOR_INVALID;
+};
+
+/*
+    Per-frame snapshot of the windows shouldRenderWindow accepts for one monitor.
+    Built once per (monitor, frame time) and reused by every workspace pass of that
+    frame, instead of each pass walking all windows and re-evaluating visibility
+    and animated values. Nodes only hold weak refs; surfaces and decorations are
+    still read live when pass elements are built.
+*/
+class CSceneSnapshot {
+  public:
+    // no-op if already built for this monitor and frame
+    void                             update(PHLMONITOR pMonitor, const Time::steady_tp& time);
+    void                             invalidate();
+
+    const std::vector<SSceneWindow>& windows() const;
+
+  private:
+    std::vector<SSceneWindow> m_windows; // capacity is kept across frames
+    MONITORID                 m_monitor = MONITOR_INVALID;
+    Time::steady_tp           m_time;
+    bool                      m_valid = false;
+};
@@ -0,0 +1,196 @@
+#include "ShaderCache.hpp"
+#include "../debug/Log.hpp"
+#include <GLES3/gl32.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <vector>
+#include <unistd.h>
+
+// bump this if the file layout changes
+constexpr static uint32_t SHADER_CACHE_MAGIC = 0x48534331; // HSC1
+
+constexpr static auto     STALE_DRIVER_DIR_AGE = std::chrono::days(30);
+
+// way past any real program binary, guards against corrupt headers
+constexpr static uint32_t SHADER_CACHE_MAX_BINARY = 64 * 1024 * 1024;
+
+struct SShaderCacheHeader {
+    uint32_t magic  = SHADER_CACHE_MAGIC;
+    uint32_t format = 0;
+    uint32_t length = 0;
+};
+
+static uint64_t fnv1a(uint64_t hash, const std::string& str) {
+    for (const unsigned char c : str) {
+        hash ^= c;
+        hash *= 0x100000001b3ULL;
+    }
+
+    // separator, so ("ab", "c") and ("a", "bc") differ
+    hash ^= 0xFF;
+    hash *= 0x100000001b3ULL;
+    return hash;
+}
+
+static std::string glString(GLenum name) {
+    const auto* STR = (const char*)glGetString(name);
+    return STR ? STR : "";
+}
+
+void CShaderCache::init() {
+    m_enabled = false;
+
+    GLint formats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    if (formats <= 0) {
+        Debug::log(LOG, "ShaderCache: driver exposes no program binary formats, disabled");
+        return;
+    }
+
+    std::string cacheRoot;
+    if (const auto CACHE_HOME = getenv("XDG_CACHE_HOME"); CACHE_HOME)
+        cacheRoot = CACHE_HOME;
+    else if (const auto HOME = getenv("HOME"); HOME)
+        cacheRoot = std::string{HOME} + "/.cache";
+    else {
+        Debug::log(WARN, "ShaderCache: no $XDG_CACHE_HOME or $HOME, disabled");
+        return;
+    }
+
+    const auto      SHADERS_DIR = cacheRoot + "/hyprland/shaders";
+    const auto      DRIVER_HASH = fnv1a(fnv1a(fnv1a(0xcbf29ce484222325ULL, glString(GL_VENDOR)), glString(GL_RENDERER)), glString(GL_VERSION));
+
+    std::error_code ec;
+    m_directory = std::format("{}/{:016x}", SHADERS_DIR, DRIVER_HASH);
+    std::filesystem::create_directories(m_directory, ec);
+    if (ec) {
+        Debug::log(WARN, "ShaderCache: can't create {}: {}, disabled", m_directory, ec.message());
+        return;
+    }
+
+    // other drivers' dirs may belong to another gpu or another instance sharing $HOME, only ones nobody used for a while go.
+    // Ours gets touched so the others leave it alone too
+    std::filesystem::last_write_time(m_directory, std::filesystem::file_time_type::clock::now(), ec);
+
+    const auto NOW = std::filesystem::file_time_type::clock::now();
+    for (auto const& entry : std::filesystem::directory_iterator(SHADERS_DIR, ec)) {
+        if (entry.path() == m_directory)
+            continue;
+
+        if (const auto MTIME = entry.last_write_time(ec); !ec && NOW - MTIME > STALE_DRIVER_DIR_AGE)
+            std::filesystem::remove_all(entry.path(), ec);
+    }
+
+    m_enabled = true;
+    Debug::log(LOG, "ShaderCache: using {}", m_directory);
+}
+
+bool CShaderCache::enabled() const {
+    return m_enabled;
+}
+
+void CShaderCache::resetStats() {
+    hits   = 0;
+    misses = 0;
+}
+
+std::string CShaderCache::pathFor(const std::string& vert, const std::string& frag) const {
+    return std::format("{}/{:016x}.bin", m_directory, fnv1a(fnv1a(0xcbf29ce484222325ULL, vert), frag));
+}
+
+GLuint CShaderCache::load(const std::string& vert, const std::string& frag) {
+    if (!m_enabled)
+        return 0;
+
+    const auto    PATH = pathFor(vert, frag);
+
+    std::ifstream ifs(PATH, std::ios::binary | std::ios::ate);
+    if (!ifs.good()) {
+        misses++;
+        return 0;
+    }
+
+    const auto FILESIZE = (uint64_t)std::max<std::streamoff>(ifs.tellg(), 0);
+    ifs.seekg(0);
+
+    SShaderCacheHeader header;
+    ifs.read((char*)&header, sizeof(header));
+
+    // the length comes from disk, never allocate more than the file actually holds
+    std::vector<char> binary;
+    if (ifs.good() && header.magic == SHADER_CACHE_MAGIC && header.length > 0 && header.length <= SHADER_CACHE_MAX_BINARY &&
+        sizeof(header) + (uint64_t)header.length == FILESIZE) {
+        binary.resize(header.length);
+        ifs.read(binary.data(), header.length);
+    }
+
+    if (!ifs.good() || binary.empty()) {
+        Debug::log(WARN, "ShaderCache: {} is corrupt, dropping it", PATH);
+        std::error_code ec;
+        std::filesystem::remove(PATH, ec);
+        misses++;
+        return 0;
+    }
+
+    const auto PROG = glCreateProgram();
+    glProgramBinary(PROG, header.format, binary.data(), binary.size());
+
+    GLint ok = GL_FALSE;
+    glGetProgramiv(PROG, GL_LINK_STATUS, &ok);
+    if (ok != GL_TRUE) {
+        // drivers may reject binaries for any reason, e.g. after an update that kept the version string
+        Debug::log(LOG, "ShaderCache: driver rejected {}, recompiling", PATH);
+        glDeleteProgram(PROG);
+        std::error_code ec;
+        std::filesystem::remove(PATH, ec);
+        misses++;
+        return 0;
+    }
+
+    hits++;
+    return PROG;
+}
+
+void CShaderCache::store(GLuint program, const std::string& vert, const std::string& frag) {
+    if (!m_enabled || !program)
+        return;
+
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+        return;
+
+    std::vector<char> binary(length);
+    GLenum            format = 0;
+    glGetProgramBinary(program, length, &length, &format, binary.data());
+    if (length <= 0)
+        return;
+
+    const auto         PATH = pathFor(vert, frag);
+    const auto         TMP  = std::format("{}.{}.tmp", PATH, getpid()); // other instances may be storing the same program
+
+    SShaderCacheHeader header{.format = format, .length = (uint32_t)length};
+
+    {
+        std::ofstream ofs(TMP, std::ios::binary | std::ios::trunc);
+        ofs.write((const char*)&header, sizeof(header));
+        ofs.write(binary.data(), length);
+
+        if (!ofs.good()) {
+            Debug::log(WARN, "ShaderCache: failed writing {}", TMP);
+            std::error_code ec;
+            std::filesystem::remove(TMP, ec);
+            return;
+        }
+    }
+
+    // rename so a crash mid-write never leaves a truncated binary behind
+    std::error_code ec;
+    std::filesystem::rename(TMP, PATH, ec);
+    if (ec)
+        Debug::log(WARN, "ShaderCache: failed to store {}: {}", PATH, ec.message());
+}
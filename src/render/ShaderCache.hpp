@@ -0,0 +1,37 @@
+#pragma once
+
+#include "../defines.hpp"
+#include <string>
+
+/*
+    On-disk cache of linked GL programs (glGetProgramBinary / glProgramBinary).
+    Binaries live in $XDG_CACHE_HOME/hyprland/shaders/<driver>/, keyed by a hash of the preprocessed sources.
+    The driver directory is derived from the GL vendor, renderer and version strings, so a driver update
+    starts with a cold cache. Other drivers' directories are kept, another gpu or instance may use them,
+    and only removed once nobody touched them for 30 days.
+
+    Anything going wrong (no binary formats, a rejected binary, I/O errors) just means a miss,
+    and the caller compiles from source.
+*/
+class CShaderCache {
+  public:
+    // needs a current GL context
+    void   init();
+
+    // returns a linked program, or 0 on a miss
+    GLuint load(const std::string& vert, const std::string& frag);
+    void   store(GLuint program, const std::string& vert, const std::string& frag);
+
+    bool   enabled() const;
+    void   resetStats();
+
+    // since the last resetStats()
+    size_t hits   = 0;
+    size_t misses = 0;
+
+  private:
+    std::string pathFor(const std::string& vert, const std::string& frag) const;
+
+    std::string m_directory;
+    bool        m_enabled = false;
+};
@@ -36,7 +36,7 @@ CBox CHyprBorderDecoration::assignedBoxGlobal() {
     CBox box = m_bAssignedGeometry;
     box.translate(g_pDecorationPositioner->getEdgeDefinedPoint(DECORATION_EDGE_BOTTOM | DECORATION_EDGE_LEFT | DECORATION_EDGE_RIGHT | DECORATION_EDGE_TOP, m_pWindow.lock()));
 
-    const auto PWORKSPACE = m_pWindow->m_workspace;
+    const auto PWORKSPACE = m_pWindow->workspace();
 
     if (!PWORKSPACE)
         return box;
@@ -89,7 +89,7 @@ void CHyprBorderDecoration::draw(PHLMONITOR pMonitor, float const& a) {
         data.lerp     = m_pWindow->m_borderFadeAnimationProgress->value();
     }
 
-    g_pHyprRenderer->m_sRenderPass.add(makeShared<CBorderPassElement>(data));
+    g_pHyprRenderer->m_sRenderPass.emplace<CBorderPassElement>(data);
 }
 
 eDecorationType CHyprBorderDecoration::getDecorationType() {
@@ -119,7 +119,7 @@ void CHyprBorderDecoration::damageEntire() {
     const auto ROUNDINGSIZE = ROUNDING - M_SQRT1_2 * ROUNDING + 2;
     const auto BORDERSIZE   = m_pWindow->getRealBorderSize() + 1;
 
-    const auto PWINDOWWORKSPACE = m_pWindow->m_workspace;
+    const auto PWINDOWWORKSPACE = m_pWindow->workspace();
     if (PWINDOWWORKSPACE && PWINDOWWORKSPACE->m_renderOffset->isBeingAnimated() && !m_pWindow->m_pinned)
         surfaceBox.translate(PWINDOWWORKSPACE->m_renderOffset->value());
     surfaceBox.translate(m_pWindow->m_floatingOffset);
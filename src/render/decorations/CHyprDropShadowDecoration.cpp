@@ -47,7 +47,7 @@ void CHyprDropShadowDecoration::damageEntire() {
                             PWINDOW->m_realSize->value().x + m_seExtents.topLeft.x + m_seExtents.bottomRight.x,
                             PWINDOW->m_realSize->value().y + m_seExtents.topLeft.y + m_seExtents.bottomRight.y};
 
-    const auto PWORKSPACE = PWINDOW->m_workspace;
+    const auto PWORKSPACE = PWINDOW->workspace();
     if (PWORKSPACE && PWORKSPACE->m_renderOffset->isBeingAnimated() && !PWINDOW->m_pinned)
         shadowBox.translate(PWORKSPACE->m_renderOffset->value());
     shadowBox.translate(PWINDOW->m_floatingOffset);
@@ -90,7 +90,7 @@ void CHyprDropShadowDecoration::draw(PHLMONITOR pMonitor, float const& a) {
     CShadowPassElement::SShadowData data;
     data.deco = this;
     data.a    = a;
-    g_pHyprRenderer->m_sRenderPass.add(makeShared<CShadowPassElement>(data));
+    g_pHyprRenderer->m_sRenderPass.emplace<CShadowPassElement>(data);
 }
 
 void CHyprDropShadowDecoration::render(PHLMONITOR pMonitor, float const& a) {
@@ -120,7 +120,7 @@ void CHyprDropShadowDecoration::render(PHLMONITOR pMonitor, float const& a) {
     const auto ROUNDINGBASE    = PWINDOW->rounding();
     const auto ROUNDINGPOWER   = PWINDOW->roundingPower();
     const auto ROUNDING        = ROUNDINGBASE > 0 ? ROUNDINGBASE + PWINDOW->getRealBorderSize() : 0;
-    const auto PWORKSPACE      = PWINDOW->m_workspace;
+    const auto PWORKSPACE      = PWINDOW->workspace();
     const auto WORKSPACEOFFSET = PWORKSPACE && !PWINDOW->m_pinned ? PWORKSPACE->m_renderOffset->value() : Vector2D();
 
     // draw the shadow
@@ -15,7 +15,8 @@ static SP<CTexture> m_tGradientInactive       = makeShared<CTexture>();
 static SP<CTexture> m_tGradientLockedActive   = makeShared<CTexture>();
 static SP<CTexture> m_tGradientLockedInactive = makeShared<CTexture>();
 
-constexpr int       BAR_TEXT_PAD = 2;
+// title key -> texture, see CTitleTex::get
+static std::unordered_map<std::string, WP<CTitleTex>> titleTexCache;
 
 CHyprGroupBarDecoration::CHyprGroupBarDecoration(PHLWINDOW pWindow) : IHyprWindowDecoration(pWindow), m_pWindow(pWindow) {
     static auto PGRADIENTS = CConfigValue<Hyprlang::INT>("group:groupbar:enabled");
@@ -104,7 +105,6 @@ void CHyprGroupBarDecoration::draw(PHLMONITOR pMonitor, float const& a) {
         return;
 
     static auto PRENDERTITLES              = CConfigValue<Hyprlang::INT>("group:groupbar:render_titles");
-    static auto PTITLEFONTSIZE             = CConfigValue<Hyprlang::INT>("group:groupbar:font_size");
     static auto PHEIGHT                    = CConfigValue<Hyprlang::INT>("group:groupbar:height");
     static auto PINDICATORGAP              = CConfigValue<Hyprlang::INT>("group:groupbar:indicator_gap");
     static auto PINDICATORHEIGHT           = CConfigValue<Hyprlang::INT>("group:groupbar:indicator_height");
@@ -137,8 +137,10 @@ void CHyprGroupBarDecoration::draw(PHLMONITOR pMonitor, float const& a) {
     if (DESIREDHEIGHT != ASSIGNEDBOX.h)
         g_pDecorationPositioner->repositionDeco(this);
 
-    float xoff = 0;
-    float yoff = 0;
+    float                      xoff = 0;
+    float                      yoff = 0;
+
+    std::vector<SP<CTitleTex>> usedTitleTexs;
 
     for (int i = 0; i < barsToDraw; ++i) {
         const auto WINDOWINDEX = *PSTACKED ? m_dwGroupMembers.size() - i - 1 : i;
@@ -170,21 +172,21 @@ void CHyprGroupBarDecoration::draw(PHLMONITOR pMonitor, float const& a) {
                         double first     = rect.w - (*PROUNDING * 2);
                         rectdata.round   = *PROUNDING;
                         rectdata.clipBox = CBox{rect.pos() - Vector2D{PADDING, 0.F}, Vector2D{first + PADDING, rect.h}};
-                        g_pHyprRenderer->m_sRenderPass.add(makeShared<CRectPassElement>(rectdata));
+                        g_pHyprRenderer->m_sRenderPass.emplace<CRectPassElement>(rectdata);
                         rectdata.round   = 0;
                         rectdata.clipBox = CBox{rect.pos() + Vector2D{first, 0.F}, Vector2D{rect.w - first + PADDING, rect.h}};
                     } else if (i == barsToDraw - 1) {
                         double first     = *PROUNDING * 2;
                         rectdata.round   = 0;
                         rectdata.clipBox = CBox{rect.pos() - Vector2D{PADDING, 0.F}, Vector2D{first + PADDING, rect.h}};
-                        g_pHyprRenderer->m_sRenderPass.add(makeShared<CRectPassElement>(rectdata));
+                        g_pHyprRenderer->m_sRenderPass.emplace<CRectPassElement>(rectdata);
                         rectdata.round   = *PROUNDING;
                         rectdata.clipBox = CBox{rect.pos() + Vector2D{first, 0.F}, Vector2D{rect.w - first + PADDING, rect.h}};
                     }
                 } else
                     rectdata.round = *PROUNDING;
             }
-            g_pHyprRenderer->m_sRenderPass.add(makeShared<CRectPassElement>(rectdata));
+            g_pHyprRenderer->m_sRenderPass.emplace<CRectPassElement>(rectdata);
         }
 
         rect = {ASSIGNEDBOX.x + xoff - pMonitor->m_position.x + m_pWindow->m_floatingOffset.x,
@@ -210,35 +212,30 @@ void CHyprGroupBarDecoration::draw(PHLMONITOR pMonitor, float const& a) {
                                 double first = rect.w - (*PGRADIENTROUNDING * 2);
                                 data.round   = *PGRADIENTROUNDING;
                                 data.clipBox = CBox{rect.pos() - Vector2D{PADDING, 0.F}, Vector2D{first + PADDING, rect.h}};
-                                g_pHyprRenderer->m_sRenderPass.add(makeShared<CTexPassElement>(data));
+                                g_pHyprRenderer->m_sRenderPass.emplace<CTexPassElement>(data);
                                 data.round   = 0;
                                 data.clipBox = CBox{rect.pos() + Vector2D{first, 0.F}, Vector2D{rect.w - first + PADDING, rect.h}};
                             } else if (i == barsToDraw - 1) {
                                 double first = *PGRADIENTROUNDING * 2;
                                 data.round   = 0;
                                 data.clipBox = CBox{rect.pos() - Vector2D{PADDING, 0.F}, Vector2D{first + PADDING, rect.h}};
-                                g_pHyprRenderer->m_sRenderPass.add(makeShared<CTexPassElement>(data));
+                                g_pHyprRenderer->m_sRenderPass.emplace<CTexPassElement>(data);
                                 data.round   = *PGRADIENTROUNDING;
                                 data.clipBox = CBox{rect.pos() + Vector2D{first, 0.F}, Vector2D{rect.w - first + PADDING, rect.h}};
                             }
                         } else
                             data.round = *PGRADIENTROUNDING;
                     }
-                    g_pHyprRenderer->m_sRenderPass.add(makeShared<CTexPassElement>(data));
+                    g_pHyprRenderer->m_sRenderPass.emplace<CTexPassElement>(data);
                 }
             }
 
             if (*PRENDERTITLES) {
-                CTitleTex* pTitleTex = textureFromTitle(m_dwGroupMembers[WINDOWINDEX]->m_title);
-
-                if (!pTitleTex)
-                    pTitleTex = m_sTitleTexs.titleTexs
-                                    .emplace_back(makeUnique<CTitleTex>(m_dwGroupMembers[WINDOWINDEX].lock(),
-                                                                        Vector2D{m_fBarWidth * pMonitor->m_scale, (*PTITLEFONTSIZE + 2L * BAR_TEXT_PAD) * pMonitor->m_scale},
-                                                                        pMonitor->m_scale))
-                                    .get();
+                const auto pTitleTex = CTitleTex::get(m_dwGroupMembers[WINDOWINDEX]->m_title, m_fBarWidth * pMonitor->m_scale - 2, pMonitor->m_scale,
+                                                      m_dwGroupMembers[WINDOWINDEX] == g_pCompositor->m_lastWindow);
+                usedTitleTexs.emplace_back(pTitleTex);
 
-                const auto titleTex = m_dwGroupMembers[WINDOWINDEX] == g_pCompositor->m_lastWindow ? pTitleTex->texActive : pTitleTex->texInactive;
+                const auto titleTex = pTitleTex->tex;
                 rect.y += std::ceil(((rect.height - titleTex->m_vSize.y) / 2.0) - (*PTEXTOFFSET * pMonitor->m_scale));
                 rect.height = titleTex->m_vSize.y;
                 rect.width  = titleTex->m_vSize.x;
@@ -249,7 +246,7 @@ void CHyprGroupBarDecoration::draw(PHLMONITOR pMonitor, float const& a) {
                 data.tex = titleTex;
                 data.box = rect;
                 data.a   = a;
-                g_pHyprRenderer->m_sRenderPass.add(makeShared<CTexPassElement>(data));
+                g_pHyprRenderer->m_sRenderPass.emplace<CTexPassElement>(data);
             }
         }
 
@@ -259,24 +256,38 @@ void CHyprGroupBarDecoration::draw(PHLMONITOR pMonitor, float const& a) {
             xoff += *PINNERGAP + m_fBarWidth;
     }
 
-    if (*PRENDERTITLES)
-        invalidateTextures();
+    // swap in this draw's titles, whatever isn't shown anymore (old titles, old scale) gets dropped here
+    m_mTitleTexs[pMonitor->m_id] = std::move(usedTitleTexs);
 }
 
-CTitleTex* CHyprGroupBarDecoration::textureFromTitle(const std::string& title) {
-    for (auto const& tex : m_sTitleTexs.titleTexs) {
-        if (tex->szContent == title)
-            return tex.get();
+SP<CTitleTex> CTitleTex::get(const std::string& title, int maxWidth, float monitorScale, bool active) {
+    static auto FALLBACKFONT             = CConfigValue<std::string>("misc:font_family");
+    static auto PTITLEFONTFAMILY         = CConfigValue<std::string>("group:groupbar:font_family");
+    static auto PTITLEFONTSIZE           = CConfigValue<Hyprlang::INT>("group:groupbar:font_size");
+    static auto PTEXTCOLOR               = CConfigValue<Hyprlang::INT>("group:groupbar:text_color");
+    static auto PTITLEFONTWEIGHTACTIVE   = CConfigValue<Hyprlang::CUSTOMTYPE>("group:groupbar:font_weight_active");
+    static auto PTITLEFONTWEIGHTINACTIVE = CConfigValue<Hyprlang::CUSTOMTYPE>("group:groupbar:font_weight_inactive");
+
+    const auto  FONTWEIGHT = (CFontWeightConfigValueData*)(active ? PTITLEFONTWEIGHTACTIVE : PTITLEFONTWEIGHTINACTIVE).ptr()->getData();
+    const auto  FONTFAMILY = *PTITLEFONTFAMILY != STRVAL_EMPTY ? *PTITLEFONTFAMILY : *FALLBACKFONT;
+
+    // everything that goes into the texture. Active and inactive share an entry if their weights match.
+    const auto KEY = std::format("{}:{}:{}:{}:{}:{}:{}", *PTITLEFONTSIZE * monitorScale, FONTWEIGHT->m_value, *PTEXTCOLOR, maxWidth, FONTFAMILY.size(), FONTFAMILY, title);
+
+    if (const auto IT = titleTexCache.find(KEY); IT != titleTexCache.end()) {
+        if (const auto TEX = IT->second.lock(); TEX)
+            return TEX;
     }
 
-    return nullptr;
-}
+    // drop whatever nobody holds anymore before adding
+    std::erase_if(titleTexCache, [](const auto& e) { return e.second.expired(); });
 
-void CHyprGroupBarDecoration::invalidateTextures() {
-    m_sTitleTexs.titleTexs.clear();
+    auto tex           = makeShared<CTitleTex>(title, maxWidth, monitorScale, active);
+    titleTexCache[KEY] = tex;
+    return tex;
 }
 
-CTitleTex::CTitleTex(PHLWINDOW pWindow, const Vector2D& bufferSize, const float monitorScale) : szContent(pWindow->m_title), pWindowOwner(pWindow) {
+CTitleTex::CTitleTex(const std::string& title, int maxWidth, float monitorScale, bool active) : szContent(title) {
     static auto      FALLBACKFONT     = CConfigValue<std::string>("misc:font_family");
     static auto      PTITLEFONTFAMILY = CConfigValue<std::string>("group:groupbar:font_family");
     static auto      PTITLEFONTSIZE   = CConfigValue<Hyprlang::INT>("group:groupbar:font_size");
@@ -291,8 +302,7 @@ CTitleTex::CTitleTex(PHLWINDOW pWindow, const Vector2D& bufferSize, const float
     const CHyprColor COLOR      = CHyprColor(*PTEXTCOLOR);
     const auto       FONTFAMILY = *PTITLEFONTFAMILY != STRVAL_EMPTY ? *PTITLEFONTFAMILY : *FALLBACKFONT;
 
-    texActive   = g_pHyprOpenGL->renderText(pWindow->m_title, COLOR, *PTITLEFONTSIZE * monitorScale, false, FONTFAMILY, bufferSize.x - 2, FONTWEIGHTACTIVE->m_value);
-    texInactive = g_pHyprOpenGL->renderText(pWindow->m_title, COLOR, *PTITLEFONTSIZE * monitorScale, false, FONTFAMILY, bufferSize.x - 2, FONTWEIGHTINACTIVE->m_value);
+    tex = g_pHyprOpenGL->renderText(title, COLOR, *PTITLEFONTSIZE * monitorScale, false, FONTFAMILY, maxWidth, active ? FONTWEIGHTACTIVE->m_value : FONTWEIGHTINACTIVE->m_value);
 }
 
 static void renderGradientTo(SP<CTexture> tex, CGradientValueData* grad) {
@@ -300,7 +310,8 @@ static void renderGradientTo(SP<CTexture> tex, CGradientValueData* grad) {
     if (!g_pCompositor->m_lastMonitor)
         return;
 
-    const Vector2D& bufferSize = g_pCompositor->m_lastMonitor->m_pixelSize;
+    // the gradient is vertical, one column is all we need, it gets stretched when drawn
+    const Vector2D bufferSize = {1, g_pCompositor->m_lastMonitor->m_pixelSize.y};
 
     const auto      CAIROSURFACE = cairo_image_surface_create(CAIRO_FORMAT_ARGB32, bufferSize.x, bufferSize.y);
     const auto      CAIRO        = cairo_create(CAIROSURFACE);
@@ -358,6 +369,21 @@ void refreshGroupBarGradients() {
     auto* const GROUPCOLACTIVELOCKED    = (CGradientValueData*)(PGROUPCOLACTIVELOCKED.ptr())->getData();
     auto* const GROUPCOLINACTIVELOCKED  = (CGradientValueData*)(PGROUPCOLINACTIVELOCKED.ptr())->getData();
 
+    // most reloads don't touch the groupbar, don't rasterize the same gradients again
+    static std::string lastKey;
+    std::string        key = g_pCompositor->m_lastMonitor ? std::format("{}", g_pCompositor->m_lastMonitor->m_pixelSize.y) : "";
+    for (auto const& grad : {GROUPCOLACTIVE, GROUPCOLINACTIVE, GROUPCOLACTIVELOCKED, GROUPCOLINACTIVELOCKED}) {
+        key += ":";
+        for (auto const& c : grad->m_colors) {
+            key += std::format("{:x},", c.getAsHex());
+        }
+    }
+
+    if (*PENABLED && *PGRADIENTS && m_tGradientActive->m_iTexID != 0 && key == lastKey)
+        return;
+
+    lastKey = key;
+
     g_pHyprRenderer->makeEGLCurrent();
 
     if (m_tGradientActive->m_iTexID != 0) {
@@ -579,7 +605,7 @@ CBox CHyprGroupBarDecoration::assignedBoxGlobal() {
     CBox box = m_bAssignedBox;
     box.translate(g_pDecorationPositioner->getEdgeDefinedPoint(DECORATION_EDGE_TOP, m_pWindow.lock()));
 
-    const auto PWORKSPACE = m_pWindow->m_workspace;
+    const auto PWORKSPACE = m_pWindow->workspace();
 
     if (PWORKSPACE && !m_pWindow->m_pinned)
         box.translate(PWORKSPACE->m_renderOffset->value());
@@ -5,18 +5,20 @@
 #include <vector>
 #include "../Texture.hpp"
 #include <string>
+#include <unordered_map>
 #include "../../helpers/memory/Memory.hpp"
 
+// a rendered title, shared by every group bar showing the same text with the same font, scale and state.
+// Bars hold handles, the texture goes away once the last one lets go.
 class CTitleTex {
   public:
-    CTitleTex(PHLWINDOW pWindow, const Vector2D& bufferSize, const float monitorScale);
+    CTitleTex(const std::string& title, int maxWidth, float monitorScale, bool active);
     ~CTitleTex() = default;
 
-    SP<CTexture> texActive;
-    SP<CTexture> texInactive;
+    SP<CTexture> tex;
     std::string  szContent;
 
-    PHLWINDOWREF pWindowOwner;
+    static SP<CTitleTex> get(const std::string& title, int maxWidth, float monitorScale, bool active);
 };
 
 void refreshGroupBarGradients();
@@ -58,9 +60,6 @@ class CHyprGroupBarDecoration : public IHyprWindowDecoration {
     float                     m_fBarWidth;
     float                     m_fBarHeight;
 
-    CTitleTex*                textureFromTitle(const std::string&);
-    void                      invalidateTextures();
-
     CBox                      assignedBoxGlobal();
 
     bool                      onBeginWindowDragOnDeco(const Vector2D&);
@@ -68,8 +67,6 @@ class CHyprGroupBarDecoration : public IHyprWindowDecoration {
     bool                      onMouseButtonOnDeco(const Vector2D&, const IPointer::SButtonEvent&);
     bool                      onScrollOnDeco(const Vector2D&, const IPointer::SAxisEvent);
 
-    struct STitleTexs {
-        // STitleTexs*                            overriden = nullptr; // TODO: make shit shared in-group to decrease VRAM usage.
-        std::vector<UP<CTitleTex>> titleTexs;
-    } m_sTitleTexs;
+    // handles to the titles drawn last time on each monitor, kept so unchanged titles aren't re-rendered
+    std::unordered_map<MONITORID, std::vector<SP<CTitleTex>>> m_mTitleTexs;
 };
@@ -9,6 +9,7 @@
 #include "../../render/Renderer.hpp"
 #include "../../Compositor.hpp"
 #include "../../protocols/core/Compositor.hpp"
+#include "../../debug/FrameTracer.hpp"
 
 bool CRenderPass::empty() const {
     return false;
@@ -19,7 +20,24 @@ bool CRenderPass::single() const {
 }
 
 void CRenderPass::add(SP<IPassElement> el) {
-    m_vPassElements.emplace_back(makeShared<SPassElementData>(CRegion{}, el));
+    m_sharedElements++;
+    addElement(el.get(), el);
+}
+
+void CRenderPass::addElement(IPassElement* elem, SP<IPassElement> owner) {
+    auto* data    = m_arena.create<SPassElementData>();
+    data->element = elem;
+    data->owner   = std::move(owner);
+    m_vPassElements.emplace_back(data);
+}
+
+size_t CRenderPass::elementCount() const {
+    return m_vPassElements.size();
+}
+
+size_t CRenderPass::allocations() const {
+    // every shared element is its own allocation
+    return m_arena.allocations() + m_sharedElements;
 }
 
 void CRenderPass::simplify() {
@@ -105,6 +123,8 @@ void CRenderPass::simplify() {
 
 void CRenderPass::clear() {
     m_vPassElements.clear();
+    m_arena.reset();
+    m_sharedElements = 0;
 }
 
 CRegion CRenderPass::render(const CRegion& damage_) {
@@ -165,8 +185,10 @@ CRegion CRenderPass::render(const CRegion& damage_) {
         for (auto& el : m_vPassElements) {
             el->elementDamage = damage;
         }
-    } else
+    } else {
+        TRACE_SCOPE("simplify", TRACE_CATEGORY_PASS);
         simplify();
+    }
 
     g_pHyprOpenGL->m_RenderData.pCurrentMonData->blurFBShouldRender = std::ranges::any_of(m_vPassElements, [](const auto& el) { return el->element->needsPrecomputeBlur(); });
 
@@ -179,6 +201,8 @@ CRegion CRenderPass::render(const CRegion& damage_) {
             continue;
         }
 
+        TRACE_SCOPE(el->element->passName(), TRACE_CATEGORY_PASS);
+
         g_pHyprOpenGL->m_RenderData.damage = el->elementDamage;
         el->element->draw(el->elementDamage);
     }
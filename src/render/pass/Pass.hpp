@@ -2,6 +2,7 @@
 
 #include "../../defines.hpp"
 #include "PassElement.hpp"
+#include "PassArena.hpp"
 
 class CGradientValueData;
 class CTexture;
@@ -15,8 +16,18 @@ class CRenderPass {
     void    clear();
     void    removeAllOfType(const std::string& type);
 
+    // constructs the element in the pass arena, it lives until the next clear()
+    template <typename T, typename... Args>
+    void emplace(Args&&... args) {
+        addElement(m_arena.create<T>(std::forward<Args>(args)...), nullptr);
+    }
+
     CRegion render(const CRegion& damage_);
 
+    // elements in this pass, and heap allocations made building it
+    size_t elementCount() const;
+    size_t allocations() const;
+
   private:
     CRegion              damage;
     std::vector<CRegion> occludedRegions;
@@ -24,17 +35,21 @@ class CRenderPass {
 
     struct SPassElementData {
         CRegion          elementDamage;
-        SP<IPassElement> element;
+        IPassElement*    element = nullptr;
+        SP<IPassElement> owner; // set for elements added as a SP, arena ones are owned by the pass
         bool             discard = false;
     };
 
-    std::vector<SP<SPassElementData>> m_vPassElements;
+    CPassArena                     m_arena;
+    std::vector<SPassElementData*> m_vPassElements;
+    size_t                         m_sharedElements = 0;
 
-    SP<IPassElement>                  currentPassInfo = nullptr;
+    SP<IPassElement>               currentPassInfo = nullptr;
 
-    void                              simplify();
-    float                             oneBlurRadius();
-    void                              renderDebugData();
+    void                           addElement(IPassElement* elem, SP<IPassElement> owner);
+    void                           simplify();
+    float                          oneBlurRadius();
+    void                           renderDebugData();
 
     struct {
         bool         present = false;
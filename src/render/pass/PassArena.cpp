@@ -0,0 +1,49 @@
+#include "PassArena.hpp"
+#include <algorithm>
+
+CPassArena::~CPassArena() {
+    reset();
+}
+
+void* CPassArena::allocate(size_t size, size_t align) {
+    const auto tryBlock = [this, size, align](SBlock& block) -> void* {
+        const auto BASE    = reinterpret_cast<uintptr_t>(block.data.get());
+        const auto ALIGNED = ((BASE + m_offset + align - 1) & ~(uintptr_t)(align - 1)) - BASE;
+
+        if (ALIGNED + size > block.size)
+            return nullptr;
+
+        m_offset = ALIGNED + size;
+        return block.data.get() + ALIGNED;
+    };
+
+    for (; m_currentBlock < m_blocks.size(); ++m_currentBlock, m_offset = 0) {
+        if (auto* p = tryBlock(m_blocks[m_currentBlock]); p)
+            return p;
+    }
+
+    // out of space, grab a new block. Oversized objects get a block of their own.
+    const size_t SIZE = std::max(BLOCK_SIZE, size + align);
+    m_blocks.emplace_back(SBlock{std::unique_ptr<std::byte[]>(new std::byte[SIZE]), SIZE});
+    m_allocations++;
+
+    m_currentBlock = m_blocks.size() - 1;
+    m_offset       = 0;
+
+    return tryBlock(m_blocks.back());
+}
+
+void CPassArena::reset() {
+    for (auto it = m_destructors.rbegin(); it != m_destructors.rend(); ++it) {
+        it->destroy(it->object);
+    }
+
+    m_destructors.clear();
+    m_currentBlock = 0;
+    m_offset       = 0;
+    m_allocations  = 0;
+}
+
+size_t CPassArena::allocations() const {
+    return m_allocations;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+    Bump allocator for the objects of a render pass.
+    Objects are constructed in place and all destroyed at once in reset(), in reverse order of creation.
+    The memory blocks are kept for the next frame, so a warmed up arena doesn't touch the heap.
+*/
+class CPassArena {
+  public:
+    CPassArena() = default;
+    ~CPassArena();
+
+    CPassArena(const CPassArena&)            = delete;
+    CPassArena& operator=(const CPassArena&) = delete;
+
+    template <typename T, typename... Args>
+    T* create(Args&&... args) {
+        T* obj = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+
+        if constexpr (!std::is_trivially_destructible_v<T>)
+            m_destructors.emplace_back(SDestructor{obj, [](void* p) { static_cast<T*>(p)->~T(); }});
+
+        return obj;
+    }
+
+    void                    reset();
+
+    // heap allocations made since the last reset
+    size_t                  allocations() const;
+
+    static constexpr size_t BLOCK_SIZE = 64 * 1024;
+
+  private:
+    void* allocate(size_t size, size_t align);
+
+    struct SBlock {
+        std::unique_ptr<std::byte[]> data;
+        size_t                       size = 0;
+    };
+
+    struct SDestructor {
+        void* object = nullptr;
+        void (*destroy)(void*);
+    };
+
+    std::vector<SBlock>      m_blocks;
+    std::vector<SDestructor> m_destructors;
+    size_t                   m_currentBlock = 0;
+    size_t                   m_offset       = 0;
+    size_t                   m_allocations  = 0;
+};
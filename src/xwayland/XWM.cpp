@@ -15,13 +15,16 @@
 #include "../protocols/core/Seat.hpp"
 #include "../managers/eventLoop/EventLoopManager.hpp"
 #include "../managers/SeatManager.hpp"
+#include "../managers/SelectionCacheManager.hpp"
 #include "../managers/ANRManager.hpp"
 #include "../protocols/XWaylandShell.hpp"
 #include "../protocols/core/Compositor.hpp"
 using namespace Hyprutils::OS;
 
 #define XCB_EVENT_RESPONSE_TYPE_MASK 0x7f
-#define INCR_CHUNK_SIZE              (64 * 1024)
+#define INCR_CHUNK_SIZE              (1024 * 1024)
+#define INCR_MAX_BUFFERED            (4 * INCR_CHUNK_SIZE)
+#define TRANSFER_READ_SIZE           (256 * 1024)
 
 static int onX11Event(int fd, uint32_t mask, void* data) {
     return g_pXWayland->pWM->onEvent(fd, mask);
@@ -581,7 +584,7 @@ void CXWM::handleSelectionNotify(xcb_selection_notify_event_t* e) {
     SXSelection* sel = getSelection(e->selection);
 
     if (e->property == XCB_ATOM_NONE) {
-        auto it = std::ranges::find_if(sel->transfers, [](const auto& t) { return !t->propertyReply; });
+        auto it = std::ranges::find_if(sel->transfers, [e](const auto& t) { return t->incomingWindow == e->requestor; });
         if (it != sel->transfers.end()) {
             Debug::log(TRACE, "[xwm] converting selection failed");
             sel->transfers.erase(it);
@@ -594,23 +597,51 @@ void CXWM::handleSelectionNotify(xcb_selection_notify_event_t* e) {
 
         setClipboardToWayland(*sel);
     } else if (!sel->transfers.empty())
-        getTransferData(*sel);
+        getTransferData(*sel, e->requestor);
 }
 
 bool CXWM::handleSelectionPropertyNotify(xcb_property_notify_event_t* e) {
-    if (e->state != XCB_PROPERTY_DELETE)
-        return false;
+    for (auto* sel : {&clipboard, &primarySelection, &dndSelection}) {
+        if (e->state == XCB_PROPERTY_DELETE) {
+            // X client took our last INCR chunk, send the next one
+            auto it = std::ranges::find_if(sel->transfers, [e](const auto& t) {
+                return !t->incomingWindow && t->incremental && t->propertySet && t->request.requestor == e->window && t->request.property == e->atom;
+            });
+            if (it == sel->transfers.end())
+                continue;
 
-    for (auto* sel : {&clipboard, &primarySelection}) {
-        auto it = std::ranges::find_if(sel->transfers, [e](const auto& t) { return t->incomingWindow == e->window; });
-        if (it != sel->transfers.end()) {
-            if (!(*it)->getIncomingSelectionProp(true)) {
+            (*it)->propertySet = false;
+            if (!sel->sendIncrChunk(**it))
                 sel->transfers.erase(it);
-                return false;
-            }
-            getTransferData(*sel);
             return true;
         }
+
+        auto it = std::ranges::find_if(sel->transfers, [e](const auto& t) { return t->incomingWindow && t->incomingWindow == e->window; });
+        if (it == sel->transfers.end())
+            continue;
+
+        // the owner put up the next INCR chunk. It only does that after we deleted the last one,
+        // and we only delete once the wayland client read all of it, so a slow reader holds the owner back.
+        auto& transfer = *it;
+        if (e->atom != HYPRATOMS["_WL_SELECTION"] || !transfer->incremental || transfer->propertyReply)
+            return true;
+
+        if (!transfer->getIncomingSelectionProp(false)) {
+            sel->transfers.erase(it);
+            return true;
+        }
+
+        if (xcb_get_property_value_length(transfer->propertyReply) == 0) {
+            Debug::log(LOG, "[xwm] incremental transfer to wl client complete");
+            xcb_delete_property(connection, transfer->incomingWindow, HYPRATOMS["_WL_SELECTION"]);
+            xcb_flush(connection);
+            sel->transfers.erase(it);
+            return true;
+        }
+
+        if (!sel->flushProperty(*transfer))
+            sel->transfers.erase(it);
+        return true;
     }
 
     return false;
@@ -1219,20 +1250,25 @@ void CXWM::setClipboardToWayland(SXSelection& sel) {
 
 static int writeDataSource(int fd, uint32_t mask, void* data) {
     auto selection = (SXSelection*)data;
-    return selection->onWrite();
+    return selection->onWrite(fd);
+}
+
+// a change_property has to fit in a single request
+static size_t maxPropertySize() {
+    return std::min<size_t>(INCR_CHUNK_SIZE, (xcb_get_maximum_request_length(g_pXWayland->pWM->connection) * 4) - 64);
 }
 
-void CXWM::getTransferData(SXSelection& sel) {
+void CXWM::getTransferData(SXSelection& sel, xcb_window_t requestor) {
     Debug::log(LOG, "[xwm] getTransferData");
 
-    auto it = std::ranges::find_if(sel.transfers, [](const auto& t) { return !t->propertyReply; });
+    auto it = std::ranges::find_if(sel.transfers, [requestor](const auto& t) { return t->incomingWindow == requestor; });
     if (it == sel.transfers.end()) {
         Debug::log(ERR, "[xwm] No pending transfer found");
         return;
     }
 
     auto& transfer = *it;
-    if (!transfer || !transfer->incomingWindow) {
+    if (transfer->propertyReply) {
         Debug::log(ERR, "[xwm] Invalid transfer state");
         sel.transfers.erase(it);
         return;
@@ -1244,33 +1280,16 @@ void CXWM::getTransferData(SXSelection& sel) {
         return;
     }
 
-    if (!transfer->propertyReply) {
-        Debug::log(ERR, "[xwm] No property reply");
-        sel.transfers.erase(it);
-        return;
-    }
-
     if (transfer->propertyReply->type == HYPRATOMS["INCR"]) {
-        transfer->incremental   = true;
-        transfer->propertyStart = 0;
+        // deleting the INCR property asked the owner for the first chunk, chunks come in as new values of it
+        transfer->incremental = true;
         free(transfer->propertyReply);
         transfer->propertyReply = nullptr;
         return;
     }
 
-    const size_t pos = std::distance(sel.transfers.begin(), it);
-    sel.onWrite();
-
-    if (pos >= sel.transfers.size())
-        return;
-
-    auto newIt = sel.transfers.begin() + pos;
-    if (newIt == sel.transfers.end() || !(*newIt))
-        return;
-
-    auto& updatedTransfer = *newIt;
-    if (updatedTransfer->eventSource && updatedTransfer->wlFD.get() != -1)
-        updatedTransfer->eventSource = wl_event_loop_add_fd(g_pCompositor->m_wlEventLoop, updatedTransfer->wlFD.get(), WL_EVENT_WRITABLE, ::writeDataSource, &sel);
+    if (!sel.flushProperty(*transfer))
+        sel.transfers.erase(it);
 }
 
 void CXWM::setCursor(unsigned char* pixData, uint32_t stride, const Vector2D& size, const Vector2D& hotspot) {
@@ -1368,12 +1387,18 @@ int SXSelection::onRead(int fd, uint32_t mask) {
 
     auto&  transfer = *it;
     size_t pre      = transfer->data.size();
-    transfer->data.resize(INCR_CHUNK_SIZE + pre);
+    transfer->data.resize(TRANSFER_READ_SIZE + pre);
 
-    auto len = read(fd, transfer->data.data() + pre, INCR_CHUNK_SIZE - 1);
+    auto len = read(fd, transfer->data.data() + pre, TRANSFER_READ_SIZE);
     if (len < 0) {
+        transfer->data.resize(pre);
+        if (errno == EAGAIN || errno == EINTR)
+            return 1;
+
         Debug::log(ERR, "[xwm] readDataSource died");
-        g_pXWayland->pWM->selectionSendNotify(&transfer->request, false);
+        // an incremental transfer already notified, the requestor just never gets its last chunk
+        if (!transfer->incremental)
+            g_pXWayland->pWM->selectionSendNotify(&transfer->request, false);
         transfers.erase(it);
         return 0;
     }
@@ -1381,18 +1406,78 @@ int SXSelection::onRead(int fd, uint32_t mask) {
     transfer->data.resize(pre + len);
 
     if (len == 0) {
+        wl_event_source_remove(transfer->eventSource);
+        transfer->eventSource = nullptr;
+        transfer->eof         = true;
+
+        if (transfer->incremental) {
+            if (!transfer->propertySet && !sendIncrChunk(*transfer))
+                transfers.erase(it);
+            return 0;
+        }
+
         Debug::log(LOG, "[xwm] Received all the bytes, final length {}", transfer->data.size());
         xcb_change_property(g_pXWayland->pWM->connection, XCB_PROP_MODE_REPLACE, transfer->request.requestor, transfer->request.property, transfer->request.target, 8,
                             transfer->data.size(), transfer->data.data());
         xcb_flush(g_pXWayland->pWM->connection);
         g_pXWayland->pWM->selectionSendNotify(&transfer->request, true);
         transfers.erase(it);
-    } else
-        Debug::log(LOG, "[xwm] Received {} bytes, waiting...", len);
+        return 0;
+    }
+
+    Debug::log(LOG, "[xwm] Received {} bytes, waiting...", len);
+
+    if (!transfer->incremental && transfer->data.size() > maxPropertySize()) {
+        // won't fit in one property, go INCR. The requestor deleting the INCR property asks for the first chunk.
+        Debug::log(LOG, "[xwm] Selection data over {} bytes, sending it incrementally", maxPropertySize());
+
+        const uint32_t MASK = XCB_EVENT_MASK_FOCUS_CHANGE | XCB_EVENT_MASK_PROPERTY_CHANGE;
+        const uint32_t SIZE = transfer->data.size(); // lower bound, we don't know the total yet
+        xcb_change_window_attributes(g_pXWayland->pWM->connection, transfer->request.requestor, XCB_CW_EVENT_MASK, &MASK);
+        xcb_change_property(g_pXWayland->pWM->connection, XCB_PROP_MODE_REPLACE, transfer->request.requestor, transfer->request.property, HYPRATOMS["INCR"], 32, 1, &SIZE);
+        xcb_flush(g_pXWayland->pWM->connection);
+        g_pXWayland->pWM->selectionSendNotify(&transfer->request, true);
+
+        transfer->incremental = true;
+        transfer->propertySet = true;
+    } else if (transfer->incremental && !transfer->propertySet && !sendIncrChunk(*transfer)) {
+        transfers.erase(it);
+        return 0;
+    }
+
+    // the X client is behind, stop reading until it catches up instead of buffering the whole paste
+    if (transfer->incremental && transfer->data.size() >= INCR_MAX_BUFFERED)
+        wl_event_source_fd_update(transfer->eventSource, 0);
 
     return 1;
 }
 
+bool SXSelection::sendIncrChunk(SXTransfer& transfer) {
+    const size_t LEN = std::min(transfer.data.size(), maxPropertySize());
+
+    // nothing buffered yet, the next read sends it
+    if (LEN == 0 && !transfer.eof)
+        return true;
+
+    xcb_change_property(g_pXWayland->pWM->connection, XCB_PROP_MODE_REPLACE, transfer.request.requestor, transfer.request.property, transfer.request.target, 8, LEN,
+                        transfer.data.data());
+    xcb_flush(g_pXWayland->pWM->connection);
+
+    transfer.data.erase(transfer.data.begin(), transfer.data.begin() + LEN);
+    transfer.propertySet = true;
+
+    // a zero-length chunk ends the transfer
+    if (LEN == 0) {
+        Debug::log(LOG, "[xwm] incremental transfer to X client complete");
+        return false;
+    }
+
+    if (transfer.eventSource && transfer.data.size() < INCR_MAX_BUFFERED)
+        wl_event_source_fd_update(transfer.eventSource, WL_EVENT_READABLE);
+
+    return true;
+}
+
 static int readDataSource(int fd, uint32_t mask, void* data) {
     Debug::log(LOG, "[xwm] readDataSource on fd {}", fd);
 
@@ -1442,7 +1527,7 @@ bool SXSelection::sendData(xcb_selection_request_event_t* e, std::string mime) {
 
     Debug::log(LOG, "[xwm] sending wayland selection to xwayland with mime {}, target {}, fds {} {}", mime, e->target, p[0], p[1]);
 
-    selection->send(mime, CFileDescriptor{p[1]});
+    g_pSelectionCacheManager->send(selection.lock(), mime, CFileDescriptor{p[1]});
 
     transfer->eventSource = wl_event_loop_add_fd(g_pCompositor->m_wlEventLoop, transfer->wlFD.get(), WL_EVENT_READABLE, ::readDataSource, this);
     transfers.emplace_back(std::move(transfer));
@@ -1450,41 +1535,63 @@ bool SXSelection::sendData(xcb_selection_request_event_t* e, std::string mime) {
     return true;
 }
 
-int SXSelection::onWrite() {
-    auto it = std::ranges::find_if(transfers, [](const auto& t) { return t->propertyReply; });
+int SXSelection::onWrite(int fd) {
+    auto it = std::ranges::find_if(transfers, [fd](const auto& t) { return t->wlFD.get() == fd && t->propertyReply; });
     if (it == transfers.end()) {
         Debug::log(ERR, "[xwm] No transfer with property data found");
         return 0;
     }
 
-    auto&   transfer  = *it;
-    char*   property  = (char*)xcb_get_property_value(transfer->propertyReply);
-    int     remainder = xcb_get_property_value_length(transfer->propertyReply) - transfer->propertyStart;
-
-    ssize_t len = write(transfer->wlFD.get(), property + transfer->propertyStart, remainder);
-    if (len == -1) {
-        if (errno == EAGAIN)
-            return 1;
-        Debug::log(ERR, "[xwm] write died in transfer get");
+    if (!flushProperty(**it))
         transfers.erase(it);
-        return 0;
-    }
 
-    if (len < remainder) {
-        transfer->propertyStart += len;
-        Debug::log(LOG, "[xwm] wl client read partially: len {}", len);
-    } else {
-        Debug::log(LOG, "[xwm] cb transfer to wl client complete, read {} bytes", len);
-        if (!transfer->incremental) {
-            transfers.erase(it);
-        } else {
-            free(transfer->propertyReply);
-            transfer->propertyReply = nullptr;
-            transfer->propertyStart = 0;
+    return 1;
+}
+
+bool SXSelection::flushProperty(SXTransfer& transfer) {
+    char*     property = (char*)xcb_get_property_value(transfer.propertyReply);
+    const int LEN      = xcb_get_property_value_length(transfer.propertyReply);
+
+    while (transfer.propertyStart < LEN) {
+        ssize_t len = write(transfer.wlFD.get(), property + transfer.propertyStart, LEN - transfer.propertyStart);
+        if (len == -1) {
+            if (errno == EINTR)
+                continue;
+
+            if (errno != EAGAIN) {
+                Debug::log(ERR, "[xwm] write died in transfer get");
+                return false;
+            }
+
+            // wl client's pipe is full, carry on once it read some
+            Debug::log(LOG, "[xwm] wl client read partially: {} of {}", transfer.propertyStart, LEN);
+            if (!transfer.eventSource)
+                transfer.eventSource = wl_event_loop_add_fd(g_pCompositor->m_wlEventLoop, transfer.wlFD.get(), WL_EVENT_WRITABLE, ::writeDataSource, this);
+            return true;
         }
+
+        transfer.propertyStart += len;
     }
 
-    return 1;
+    Debug::log(LOG, "[xwm] cb transfer to wl client complete, wrote {} bytes", LEN);
+
+    if (transfer.eventSource) {
+        wl_event_source_remove(transfer.eventSource);
+        transfer.eventSource = nullptr;
+    }
+
+    free(transfer.propertyReply);
+    transfer.propertyReply = nullptr;
+    transfer.propertyStart = 0;
+
+    if (!transfer.incremental)
+        return false;
+
+    // ask the owner for the next chunk
+    xcb_delete_property(g_pXWayland->pWM->connection, transfer.incomingWindow, HYPRATOMS["_WL_SELECTION"]);
+    xcb_flush(g_pXWayland->pWM->connection);
+
+    return true;
 }
 
 SXTransfer::~SXTransfer() {
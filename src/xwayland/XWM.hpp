@@ -25,6 +25,7 @@ struct SXTransfer {
     bool                           incremental   = false;
     bool                           flushOnDelete = false;
     bool                           propertySet   = false;
+    bool                           eof           = false; // wayland source is done, whatever's in data is the rest
 
     Hyprutils::OS::CFileDescriptor wlFD;
     wl_event_source*               eventSource = nullptr;
@@ -33,9 +34,9 @@ struct SXTransfer {
 
     xcb_selection_request_event_t  request;
 
-    int                            propertyStart;
-    xcb_get_property_reply_t*      propertyReply;
-    xcb_window_t                   incomingWindow;
+    int                            propertyStart  = 0;
+    xcb_get_property_reply_t*      propertyReply  = nullptr;
+    xcb_window_t                   incomingWindow = 0; // set for X -> wayland transfers
 
     bool                           getIncomingSelectionProp(bool erase);
 };
@@ -51,7 +52,9 @@ struct SXSelection {
     void             onKeyboardFocus();
     bool             sendData(xcb_selection_request_event_t* e, std::string mime);
     int              onRead(int fd, uint32_t mask);
-    int              onWrite();
+    int              onWrite(int fd);
+    bool             flushProperty(SXTransfer& transfer);
+    bool             sendIncrChunk(SXTransfer& transfer);
 
     struct {
         CHyprSignalListener setSelection;
@@ -167,7 +170,7 @@ class CXWM {
     xcb_atom_t   mimeToAtom(const std::string& mime);
     std::string  mimeFromAtom(xcb_atom_t atom);
     void         setClipboardToWayland(SXSelection& sel);
-    void         getTransferData(SXSelection& sel);
+    void         getTransferData(SXSelection& sel, xcb_window_t requestor);
     std::string  getAtomName(uint32_t atom);
     void         readProp(SP<CXWaylandSurface> XSURF, uint32_t atom, xcb_get_property_reply_t* reply);
 